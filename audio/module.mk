@@ -71,6 +71,7 @@ MODULE_OBJS := \
 	softsynth/fluidsynth.o \
 	softsynth/eas.o \
 	softsynth/pcspk.o \
+	softsynth/renderahead.o \
 	softsynth/ay8912.o
 
 ifdef USE_HMI_AUDIO
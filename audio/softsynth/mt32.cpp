@@ -25,6 +25,7 @@
 #ifdef USE_MT32EMU
 
 #include "audio/softsynth/emumidi.h"
+#include "audio/softsynth/renderahead.h"
 #include "audio/softsynth/mt32/font_6x8.h"
 #include "audio/softsynth/mt32/lcd_bg_data.h"
 #include "audio/musicplugin.h"
@@ -239,6 +240,29 @@ private:
 
 	int _outputRate;
 
+	// Render-ahead state. When enabled, the mixer callback keeps audio
+	// rendered ahead of playback, topped up within a time budget each call,
+	// so that expensive passages can draw on it. Only the mixer thread
+	// touches the rendered audio, but the playback position is protected by
+	// _mutex, as events are timestamped from it.
+	enum {
+		kRenderAheadMinLatency = 30, // in milliseconds
+		kRenderAheadPrefill = 10,    // in milliseconds
+		kRenderAheadChunk = 256      // in frames
+	};
+
+	Audio::RenderAheadBuffer *_renderAhead;
+	uint32 _underruns;
+
+	// When rendering ahead, the MIDI timer runs on the timer manager instead
+	// of inside the rendering loop, so that all events are timestamped
+	Common::TimerManager::TimerProc _midiTimerProc;
+	void *_midiTimerParam;
+	bool _midiTimerInstalled;
+
+	void fillRenderAhead(uint32 budgetMillis);
+	uint32 getEventTimestamp();
+
 protected:
 	void generateSamples(int16 *buf, int len) override;
 
@@ -248,6 +272,7 @@ public:
 
 	int open() override;
 	void close() override;
+	void setTimerCallback(void *timer_param, Common::TimerManager::TimerProc timer_proc) override;
 	void send(uint32 b) override;
 	void setPitchBendRange(byte channel, uint range) override;
 	void sysEx(const byte *msg, uint16 length) override;
@@ -257,6 +282,7 @@ public:
 	MidiChannel *getPercussionChannel() override;
 
 	// AudioStream API
+	int readBuffer(int16 *data, const int numSamples) override;
 	bool isStereo() const override { return true; }
 	int getRate() const override { return _outputRate; }
 };
@@ -276,6 +302,11 @@ MidiDriver_MT32::MidiDriver_MT32(Audio::Mixer *mixer) : MidiDriver_Emulated(mixe
 	_outputRate = 0;
 	_controlData = nullptr;
 	_pcmData = nullptr;
+	_renderAhead = nullptr;
+	_underruns = 0;
+	_midiTimerProc = nullptr;
+	_midiTimerParam = nullptr;
+	_midiTimerInstalled = false;
 }
 
 MidiDriver_MT32::~MidiDriver_MT32() {
@@ -341,16 +372,64 @@ int MidiDriver_MT32::open() {
 
 	MidiDriver_Emulated::open();
 
+	// Optionally render ahead of the mixer, so that expensive passages do not
+	// have to be rendered within the audio callback deadline. This delays
+	// the music by the configured latency.
+	int latency = ConfMan.hasKey("mt32_render_ahead") ? ConfMan.getInt("mt32_render_ahead") : 0;
+	if (latency > 0) {
+		latency = MAX<int>(latency, kRenderAheadMinLatency);
+		_renderAhead = new Audio::RenderAheadBuffer(_outputRate * latency / 1000, _outputRate);
+		_renderAhead->advancePlayback(0, g_system->getMillis(true));
+		_underruns = 0;
+
+		// Only start filling here, the mixer callbacks top up the rest
+		fillRenderAhead(kRenderAheadPrefill);
+		debug(4, "MT-32 emulator renders %d ms ahead", latency);
+
+		// Move a timer callback set before opening to the timer manager
+		if (_midiTimerProc)
+			setTimerCallback(_midiTimerParam, _midiTimerProc);
+	}
+
 	_mixer->playStream(Audio::Mixer::kPlainSoundType, &_mixerSoundHandle, this, -1, Audio::Mixer::kMaxChannelVolume, 0, DisposeAfterUse::NO, true);
 
 	return 0;
 }
 
+void MidiDriver_MT32::setTimerCallback(void *timer_param, Common::TimerManager::TimerProc timer_proc) {
+	if (_midiTimerInstalled) {
+		g_system->getTimerManager()->removeTimerProc(_midiTimerProc);
+		_midiTimerInstalled = false;
+	}
+	_midiTimerProc = timer_proc;
+	_midiTimerParam = timer_param;
+
+	// Events sent from the rendering loop would land wherever the renderer
+	// happens to be, ahead of playback, so they could not be told apart from
+	// the other events and timestamped alike
+	if (_renderAhead && timer_proc) {
+		MidiDriver_Emulated::setTimerCallback(nullptr, nullptr);
+		g_system->getTimerManager()->installTimerProc(timer_proc, getBaseTempo(), timer_param, "MT32tempo");
+		_midiTimerInstalled = true;
+	} else {
+		MidiDriver_Emulated::setTimerCallback(timer_param, timer_proc);
+	}
+}
+
+uint32 MidiDriver_MT32::getEventTimestamp() {
+	// Events are placed at a constant latency after the current playback
+	// position, instead of wherever the renderer happens to be
+	return _service.convertOutputToSynthTimestamp(_renderAhead->getEventFrame(g_system->getMillis(true)));
+}
+
 void MidiDriver_MT32::send(uint32 b) {
 	midiDriverCommonSend(b);
 
 	Common::StackLock lock(_mutex);
-	_service.playMsg(b);
+	if (_renderAhead)
+		_service.playMsgAt(b, getEventTimestamp());
+	else
+		_service.playMsg(b);
 }
 
 // Indiana Jones and the Fate of Atlantis (including the demo) uses
@@ -368,7 +447,10 @@ void MidiDriver_MT32::sysEx(const byte *msg, uint16 length) {
 	midiDriverCommonSysEx(msg, length);
 	if (msg[0] == 0xf0) {
 		Common::StackLock lock(_mutex);
-		_service.playSysex(msg, length);
+		if (_renderAhead)
+			_service.playSysexAt(msg, length, getEventTimestamp());
+		else
+			_service.playSysex(msg, length);
 	} else {
 		enum {
 			SYSEX_CMD_DT1 = 0x12,
@@ -394,6 +476,13 @@ void MidiDriver_MT32::close() {
 	// Detach the mixer callback handler
 	_mixer->stopHandle(_mixerSoundHandle);
 
+	if (_renderAhead) {
+		if (_underruns)
+			debug(1, "MT-32 emulator ran out of rendered audio %d times", _underruns);
+		delete _renderAhead;
+		_renderAhead = nullptr;
+	}
+
 	Common::StackLock lock(_mutex);
 	_service.closeSynth();
 	_service.freeContext();
@@ -408,6 +497,47 @@ void MidiDriver_MT32::generateSamples(int16 *data, int len) {
 	_service.renderBit16s(data, len);
 }
 
+void MidiDriver_MT32::fillRenderAhead(uint32 budgetMillis) {
+	const uint32 startMillis = g_system->getMillis(true);
+	uint32 len;
+	int16 *data = _renderAhead->getWriteBuffer(len);
+	while (len > 0 && g_system->getMillis(true) - startMillis < budgetMillis) {
+		len = MIN<uint32>(len, kRenderAheadChunk);
+		MidiDriver_Emulated::readBuffer(data, len * 2);
+		_renderAhead->commitWrite(len);
+		data = _renderAhead->getWriteBuffer(len);
+	}
+}
+
+int MidiDriver_MT32::readBuffer(int16 *data, const int numSamples) {
+	if (!_renderAhead)
+		return MidiDriver_Emulated::readBuffer(data, numSamples);
+
+	const uint32 startMillis = g_system->getMillis(true);
+	const uint32 frames = numSamples / 2;
+	const uint32 copied = _renderAhead->read(data, frames);
+
+	// The rendered audio ran out, so the rest has to be rendered right away
+	if (copied < frames) {
+		MidiDriver_Emulated::readBuffer(data + copied * 2, (frames - copied) * 2);
+		_underruns++;
+	}
+
+	{
+		Common::StackLock lock(_mutex);
+		_renderAhead->advancePlayback(frames, startMillis);
+	}
+
+	// Top up with at most half of the time this buffer lasts, so cheap
+	// passages fill up again and expensive ones leave time to the mixer
+	const uint32 budget = MAX<uint32>(frames * 500 / _outputRate, 1);
+	const uint32 elapsed = g_system->getMillis(true) - startMillis;
+	if (elapsed < budget)
+		fillRenderAhead(budget - elapsed);
+
+	return numSamples;
+}
+
 uint32 MidiDriver_MT32::property(int prop, uint32 param) {
 	switch (prop) {
 	case PROP_CHANNEL_MASK:
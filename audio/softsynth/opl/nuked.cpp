@@ -71,6 +71,30 @@
  *   - Minor: __builtin_ctz for the envelope timer on GCC/Clang with a
  *     portable fallback; replaced the tremolo-position modulo with an
  *     explicit wrap.
+ *
+ * ScummVM additions:
+ *
+ *   - OPL3_GenerateStreamBlock: generates all the chip samples needed for a
+ *     batch of output samples back to back, then resamples them in a
+ *     separate pass. Output is identical to OPL3_GenerateStream.
+ *
+ * A batched per-operator pass (one slot over many samples, or all slots of
+ * a sample in SIMD lanes) is not used, as it cannot stay bit-exact or pay
+ * off here:
+ *
+ *   - Across samples, every slot is a serial recurrence: feedback reads the
+ *     previous two outputs (prout/out), the envelope is a state machine
+ *     stepped by the chip-wide eg_timer/eg_state, and buffered register
+ *     writes land between any two samples (writebuf), changing rates,
+ *     f_num and the algorithm mid-block.
+ *   - Within a sample, carriers read their modulator's output of the same
+ *     sample through *mod, 4-op voices chain two channels, and the rhythm
+ *     slots 13/16/17 share phase bits, so generation must follow slot order.
+ *   - What is left per slot (envelope, phase) is branchy and table driven:
+ *     logsin_wf and exprom lookups need gathers, which SSE2/NEON lack, and
+ *     a lane-wide pass would have to process the silent slots the fast
+ *     paths in OPL3_ProcessSlot skip, which are most slots in typical
+ *     game music.
  */
 
 #include <stdlib.h>
@@ -1697,6 +1721,82 @@ void OPL3_GenerateStream(opl3_chip *chip, int16_t *sndptr, uint32_t numsamples)
     }
 }
 
+/* Chip emulation does not depend on the resampler state, so the chip samples
+ * can be generated in batches ahead of the interpolation without altering
+ * the output. Keeping OPL3_Generate4Ch in a tight loop avoids interleaving it
+ * with the resampler, and lets the interpolation run over a flat buffer. */
+void OPL3_GenerateStreamBlock(opl3_chip *chip, int16_t *sndptr, uint32_t numsamples)
+{
+    int16_t block[OPL_BLOCK_SIZE][4];
+
+    while (numsamples > 0)
+    {
+        uint32_t count = 0;
+        uint32_t needed = 0;
+        int32_t samplecnt = chip->samplecnt;
+        uint32_t i, j;
+
+        /* Find how many output samples the next block of chip samples covers */
+        while (count < numsamples)
+        {
+            uint32_t gen = 0;
+            int32_t cnt = samplecnt;
+            while (cnt >= chip->rateratio)
+            {
+                cnt -= chip->rateratio;
+                gen++;
+            }
+            if (needed + gen > OPL_BLOCK_SIZE)
+            {
+                break;
+            }
+            needed += gen;
+            samplecnt = cnt + (1 << RSM_FRAC);
+            count++;
+        }
+
+        if (count == 0)
+        {
+            /* Extremely low output rate, a single sample spans the block */
+            OPL3_GenerateResampled(chip, sndptr);
+            sndptr += 2;
+            numsamples--;
+            continue;
+        }
+
+        for (j = 0; j < needed; j++)
+        {
+            OPL3_Generate4Ch(chip, block[j]);
+        }
+
+        j = 0;
+        for (i = 0; i < count; i++)
+        {
+            while (chip->samplecnt >= chip->rateratio)
+            {
+                chip->oldsamples[0] = chip->samples[0];
+                chip->oldsamples[1] = chip->samples[1];
+                chip->oldsamples[2] = chip->samples[2];
+                chip->oldsamples[3] = chip->samples[3];
+                chip->samples[0] = block[j][0];
+                chip->samples[1] = block[j][1];
+                chip->samples[2] = block[j][2];
+                chip->samples[3] = block[j][3];
+                j++;
+                chip->samplecnt -= chip->rateratio;
+            }
+            sndptr[0] = (int16_t)((chip->oldsamples[0] * (chip->rateratio - chip->samplecnt)
+                                  + chip->samples[0] * chip->samplecnt) / chip->rateratio);
+            sndptr[1] = (int16_t)((chip->oldsamples[1] * (chip->rateratio - chip->samplecnt)
+                                  + chip->samples[1] * chip->samplecnt) / chip->rateratio);
+            chip->samplecnt += 1 << RSM_FRAC;
+            sndptr += 2;
+        }
+
+        numsamples -= count;
+    }
+}
+
 
 OPL::OPL(Config::OplType type) : _type(type), _rate(0) {
 }
@@ -1793,7 +1893,7 @@ void OPL::dualWrite(uint8 index, uint8 reg, uint8 val) {
 }
 
 void OPL::generateSamples(int16*buffer, int length) {
-	OPL3_GenerateStream(&chip, (int16_t*)buffer, (uint16_t)length / 2);
+	OPL3_GenerateStreamBlock(&chip, (int16_t*)buffer, (uint32_t)length / 2);
 }
 
 }
@@ -0,0 +1,82 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "audio/softsynth/renderahead.h"
+
+#include "common/util.h"
+
+namespace Audio {
+
+RenderAheadBuffer::RenderAheadBuffer(uint32 frames, uint32 rate) {
+	// One slot stays free to tell a full ring from an empty one
+	_capacity = frames;
+	_size = frames + 1;
+	_ring = new int16[_size * 2];
+	_read = _write = 0;
+	_rate = rate;
+	_playedFrames = 0;
+	_playedMillis = 0;
+}
+
+RenderAheadBuffer::~RenderAheadBuffer() {
+	delete[] _ring;
+}
+
+uint32 RenderAheadBuffer::getBufferedFrames() const {
+	return (_write + _size - _read) % _size;
+}
+
+int16 *RenderAheadBuffer::getWriteBuffer(uint32 &frames) {
+	frames = MIN(_capacity - getBufferedFrames(), _size - _write);
+	return _ring + _write * 2;
+}
+
+void RenderAheadBuffer::commitWrite(uint32 frames) {
+	assert(frames <= _capacity - getBufferedFrames() && frames <= _size - _write);
+	_write = (_write + frames) % _size;
+}
+
+uint32 RenderAheadBuffer::read(int16 *data, uint32 frames) {
+	uint32 copied = 0;
+	while (copied < frames && _read != _write) {
+		const uint32 end = _write > _read ? _write : _size;
+		const uint32 step = MIN(frames - copied, end - _read);
+		memcpy(data + copied * 2, _ring + _read * 2, step * 2 * sizeof(int16));
+		copied += step;
+		_read = (_read + step) % _size;
+	}
+	return copied;
+}
+
+void RenderAheadBuffer::advancePlayback(uint32 frames, uint32 nowMillis) {
+	_playedFrames += frames;
+	_playedMillis = nowMillis;
+}
+
+uint32 RenderAheadBuffer::getEventFrame(uint32 nowMillis) const {
+	// The playback position is interpolated from the time since the mixer
+	// last asked for audio, without running past the rendered audio
+	uint32 elapsedFrames = (uint64)(nowMillis - _playedMillis) * _rate / 1000;
+	elapsedFrames = MIN(elapsedFrames, _capacity);
+	return _playedFrames + elapsedFrames + _capacity;
+}
+
+} // End of namespace Audio
@@ -0,0 +1,91 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef AUDIO_SOFTSYNTH_RENDERAHEAD_H
+#define AUDIO_SOFTSYNTH_RENDERAHEAD_H
+
+#include "common/scummsys.h"
+
+namespace Audio {
+
+/**
+ * A ring of 16-bit stereo audio rendered ahead of playback.
+ *
+ * Emulated synthesizers use it to render in advance of the mixer, so that
+ * expensive passages can draw on what cheap ones left over. It also keeps
+ * track of the playback position, so that events sent from outside of the
+ * rendering loop can be placed at a constant latency after it.
+ *
+ * The buffer does no locking: the caller has to synchronize the playback
+ * position between the mixer thread and the threads sending events.
+ */
+class RenderAheadBuffer {
+public:
+	RenderAheadBuffer(uint32 frames, uint32 rate);
+	~RenderAheadBuffer();
+
+	/** Return how many frames can be rendered ahead at most. */
+	uint32 getCapacity() const { return _capacity; }
+
+	/** Return how many frames are rendered and not played yet. */
+	uint32 getBufferedFrames() const;
+
+	/**
+	 * Return where the next frames are to be rendered to. 'frames' is set
+	 * to how many of them fit there at most, which may be less than the free
+	 * space when the ring wraps around.
+	 */
+	int16 *getWriteBuffer(uint32 &frames);
+
+	/** Add 'frames' frames written to the buffer returned by getWriteBuffer(). */
+	void commitWrite(uint32 frames);
+
+	/**
+	 * Copy up to 'frames' rendered frames to 'data'.
+	 *
+	 * @return The number of frames copied.
+	 */
+	uint32 read(int16 *data, uint32 frames);
+
+	/** Record that 'frames' frames started playing at 'nowMillis'. */
+	void advancePlayback(uint32 frames, uint32 nowMillis);
+
+	/**
+	 * Return the output frame at which an event sent at 'nowMillis' has to
+	 * be played, one buffer length after the current playback position.
+	 */
+	uint32 getEventFrame(uint32 nowMillis) const;
+
+private:
+	int16 *_ring;
+	uint32 _capacity;
+	uint32 _size;  // in frames, one more than _capacity
+	uint32 _read;  // in frames
+	uint32 _write; // in frames
+	uint32 _rate;
+
+	uint32 _playedFrames;
+	uint32 _playedMillis;
+};
+
+} // End of namespace Audio
+
+#endif
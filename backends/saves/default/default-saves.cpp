@@ -34,6 +34,7 @@
 #include "common/savefile.h"
 #include "common/util.h"
 #include "common/fs.h"
+#include "common/ptr.h"
 #include "common/archive.h"
 #include "common/config-manager.h"
 #include "common/compression/deflate.h"
@@ -171,6 +172,7 @@ Common::OutSaveFile *DefaultSaveFileManager::openForSaving(const Common::String
 
 	// Add file to cache now that it exists.
 	_saveFileCache[filename] = Common::FSNode(fileNode.getPath());
+	_metadataIndex.erase(filename);
 
 	return result;
 }
@@ -200,6 +202,7 @@ bool DefaultSaveFileManager::removeSavefile(const Common::String &filename) {
 		// Remove from cache, this invalidates the 'file' iterator.
 		_saveFileCache.erase(file);
 		file = _saveFileCache.end();
+		_metadataIndex.erase(filename);
 
 		Common::ErrorCode result = removeFile(fileNode);
 		if (result == Common::kNoError)
@@ -235,6 +238,36 @@ bool DefaultSaveFileManager::exists(const Common::String &filename) {
 	return _saveFileCache.contains(filename);
 }
 
+bool DefaultSaveFileManager::getSavefileMetadata(const Common::String &filename, Common::SavefileMetadata &metadata) {
+	SavefileMetadataIndex::const_iterator entry = _metadataIndex.find(filename);
+	if (entry == _metadataIndex.end())
+		return false;
+
+	// Validate the entry against the current file size, in case the file
+	// was changed behind our back. Opening the raw file is much cheaper
+	// than decompressing it to read the header again.
+	Common::ScopedPtr<Common::InSaveFile> file(openRawFile(filename));
+	if (!file || file->size() != entry->_value.fileSize) {
+		_metadataIndex.erase(filename);
+		return false;
+	}
+
+	metadata = entry->_value;
+	return true;
+}
+
+void DefaultSaveFileManager::setSavefileMetadata(const Common::String &filename, const Common::SavefileMetadata &metadata) {
+	assureCached(getSavePath());
+	if (getError().getCode() != Common::kNoError || !_saveFileCache.contains(filename))
+		return;
+
+	Common::SavefileMetadata &entry = _metadataIndex[filename];
+	entry = metadata;
+
+	Common::ScopedPtr<Common::InSaveFile> file(openRawFile(filename));
+	entry.fileSize = file ? file->size() : -1;
+}
+
 Common::Path DefaultSaveFileManager::getSavePath() const {
 
 	Common::Path dir;
@@ -293,6 +326,17 @@ void DefaultSaveFileManager::assureCached(const Common::Path &savePathName) {
 		}
 	}
 
+	// Drop the indexed metadata of files which are gone
+	if (_metadataIndexDirectory != savePathName) {
+		_metadataIndex.clear();
+		_metadataIndexDirectory = savePathName;
+	} else {
+		for (SavefileMetadataIndex::iterator entry = _metadataIndex.begin(); entry != _metadataIndex.end(); ++entry) {
+			if (!_saveFileCache.contains(entry->_key))
+				_metadataIndex.erase(entry);
+		}
+	}
+
 	// Only now store that we cached 'savePathName' to indicate we successfully
 	// cached the directory.
 	_cachedDirectory = savePathName;
@@ -44,6 +44,9 @@ public:
 	bool removeSavefile(const Common::String &filename) override;
 	bool exists(const Common::String &filename) override;
 
+	bool getSavefileMetadata(const Common::String &filename, Common::SavefileMetadata &metadata) override;
+	void setSavefileMetadata(const Common::String &filename, const Common::SavefileMetadata &metadata) override;
+
 #ifdef USE_CLOUD
 
 	static const uint32 INVALID_TIMESTAMP = UINT_MAX;
@@ -93,6 +96,15 @@ protected:
 	 */
 	SaveFileCache _saveFileCache;
 
+	typedef Common::HashMap<Common::String, Common::SavefileMetadata, Common::IgnoreCase_Hash, Common::IgnoreCase_EqualTo> SavefileMetadataIndex;
+
+	/**
+	 * Header information of the save files in the currently cached directory.
+	 * Entries are removed in openForSaving and removeSavefile, and dropped
+	 * for files which are gone when the directory is cached again.
+	 */
+	SavefileMetadataIndex _metadataIndex;
+
 	/**
 	 * List of "locked" files. These cannot be used for saving/loading
 	 * because CloudManager is downloading those.
@@ -104,6 +116,11 @@ private:
 	 * The currently cached directory.
 	 */
 	Common::Path _cachedDirectory;
+
+	/**
+	 * The directory the metadata index belongs to.
+	 */
+	Common::Path _metadataIndexDirectory;
 };
 
 #endif
@@ -216,6 +216,8 @@ static const char HELP_STRING4[] =
 	"                           playback by Event Recorder\n"
 	"  --screenshot-period=NUM  When recording, trigger a screenshot every NUM milliseconds\n"
 	"                           (default: 60000)\n"
+	"  --record-profile=FILE    During playback, write the real time spent on each\n"
+	"                           frame to FILE (CSV)\n"
 	"  --list-records           Display a list of recordings for the target specified\n"
 	"  --list-records-json      Display a list of recordings in JSON format for the target specified\n"
 #endif
@@ -838,6 +840,9 @@ Common::String parseCommandLine(Common::StringMap &settings, int argc, const cha
 
 			DO_LONG_OPTION_INT("screenshot-period")
 			END_OPTION
+
+			DO_LONG_OPTION("record-profile")
+			END_OPTION
 #endif
 
 			DO_LONG_OPTION("opl-driver")
@@ -0,0 +1,218 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "lua_arena.h"
+#include "common/util.h"
+
+namespace Lua {
+
+namespace {
+
+enum {
+	kChunkSize = 32 * 1024,
+	// Keeps the blocks of a chunk aligned like malloc() results
+	kChunkHeaderSize = kArenaGranularity
+};
+
+struct FreeBlock {
+	FreeBlock *next;
+};
+
+class Arena {
+public:
+	Arena() : _chunks(nullptr), _chunkPos(nullptr), _chunkEnd(nullptr) {
+		memset(_freeLists, 0, sizeof(_freeLists));
+		memset(&_stats, 0, sizeof(_stats));
+	}
+
+	~Arena() {
+		while (_chunks) {
+			byte *next = *(byte **)_chunks;
+			free(_chunks);
+			_chunks = next;
+		}
+	}
+
+	static void *luaAlloc(void *ud, void *ptr, size_t osize, size_t nsize);
+
+	const ArenaStats &getStats() const { return _stats; }
+
+private:
+	/** Maps a size to its class, 0 to kArenaSizeClasses - 1, or kArenaSizeClasses if it is too big */
+	static uint sizeClass(size_t size) {
+		return size <= kArenaMaxSmallSize ? (uint)(size - 1) / kArenaGranularity : (uint)kArenaSizeClasses;
+	}
+
+	void *allocate(size_t size);
+	void release(void *ptr, size_t size);
+	void *reallocate(void *ptr, size_t osize, size_t nsize);
+	void *carve(uint cls);
+
+	byte *_chunks;   ///< Singly linked through the first word of each chunk
+	byte *_chunkPos;
+	byte *_chunkEnd;
+	FreeBlock *_freeLists[kArenaSizeClasses];
+	ArenaStats _stats;
+};
+
+void *Arena::carve(uint cls) {
+	const size_t blockSize = (cls + 1) * kArenaGranularity;
+
+	if ((size_t)(_chunkEnd - _chunkPos) < blockSize) {
+		// Hand the unused tail of the current chunk to the matching free list
+		if (_chunkPos < _chunkEnd) {
+			const uint tailClass = (_chunkEnd - _chunkPos) / kArenaGranularity - 1;
+			FreeBlock *tail = (FreeBlock *)_chunkPos;
+			tail->next = _freeLists[tailClass];
+			_freeLists[tailClass] = tail;
+		}
+
+		byte *chunk = (byte *)malloc(kChunkSize);
+		if (!chunk)
+			return nullptr;
+		*(byte **)chunk = _chunks;
+		_chunks = chunk;
+		_chunkPos = chunk + kChunkHeaderSize;
+		_chunkEnd = chunk + kChunkSize;
+		_stats.chunkBytes += kChunkSize;
+	}
+
+	void *block = _chunkPos;
+	_chunkPos += blockSize;
+	return block;
+}
+
+void *Arena::allocate(size_t size) {
+	const uint cls = sizeClass(size);
+	void *block;
+
+	if (cls == kArenaSizeClasses) {
+		block = malloc(size);
+		if (!block)
+			return nullptr;
+		_stats.largeAllocCount++;
+		_stats.largeBytesInUse += size;
+	} else {
+		FreeBlock *head = _freeLists[cls];
+		if (head) {
+			_freeLists[cls] = head->next;
+			block = head;
+		} else {
+			block = carve(cls);
+			if (!block)
+				return nullptr;
+		}
+		_stats.classBlocks[cls]++;
+	}
+
+	_stats.allocCount++;
+	_stats.bytesInUse += size;
+	if (_stats.bytesInUse > _stats.peakBytesInUse)
+		_stats.peakBytesInUse = _stats.bytesInUse;
+	return block;
+}
+
+void Arena::release(void *ptr, size_t size) {
+	const uint cls = sizeClass(size);
+
+	if (cls == kArenaSizeClasses) {
+		free(ptr);
+		_stats.largeBytesInUse -= size;
+	} else {
+		FreeBlock *block = (FreeBlock *)ptr;
+		block->next = _freeLists[cls];
+		_freeLists[cls] = block;
+		_stats.classBlocks[cls]--;
+	}
+
+	_stats.freeCount++;
+	_stats.bytesInUse -= size;
+}
+
+void *Arena::reallocate(void *ptr, size_t osize, size_t nsize) {
+	const uint oldClass = sizeClass(osize);
+
+	if (oldClass == sizeClass(nsize)) {
+		if (oldClass == kArenaSizeClasses) {
+			void *block = realloc(ptr, nsize);
+			if (!block)
+				return nullptr;
+			ptr = block;
+			_stats.largeBytesInUse = _stats.largeBytesInUse - osize + nsize;
+		}
+		_stats.reallocInPlace++;
+		_stats.bytesInUse = _stats.bytesInUse - osize + nsize;
+		if (_stats.bytesInUse > _stats.peakBytesInUse)
+			_stats.peakBytesInUse = _stats.bytesInUse;
+		return ptr;
+	}
+
+	// On failure Lua keeps using the old block, so it must stay untouched
+	void *block = allocate(nsize);
+	if (!block)
+		return nullptr;
+	memcpy(block, ptr, MIN(osize, nsize));
+	release(ptr, osize);
+	return block;
+}
+
+void *Arena::luaAlloc(void *ud, void *ptr, size_t osize, size_t nsize) {
+	Arena *arena = (Arena *)ud;
+
+	if (nsize == 0) {
+		if (ptr)
+			arena->release(ptr, osize);
+		return nullptr;
+	}
+
+	return ptr ? arena->reallocate(ptr, osize, nsize) : arena->allocate(nsize);
+}
+
+} // End of anonymous namespace
+
+lua_State *newArenaState() {
+	Arena *arena = new Arena();
+	lua_State *L = lua_newstate(&Arena::luaAlloc, arena);
+	if (!L)
+		delete arena;
+	return L;
+}
+
+void closeArenaState(lua_State *L) {
+	void *ud;
+	const lua_Alloc alloc = lua_getallocf(L, &ud);
+
+	// Every block is handed back to the arena first, then all chunks go at once
+	lua_close(L);
+	if (alloc == &Arena::luaAlloc)
+		delete (Arena *)ud;
+}
+
+bool getArenaStats(lua_State *L, ArenaStats &stats) {
+	void *ud;
+	if (lua_getallocf(L, &ud) != &Arena::luaAlloc)
+		return false;
+
+	stats = ((const Arena *)ud)->getStats();
+	return true;
+}
+
+} // End of namespace Lua
@@ -0,0 +1,70 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef LUA_ARENA_H
+#define LUA_ARENA_H
+
+#include "common/scummsys.h"
+#include "lua.h"
+
+namespace Lua {
+
+enum {
+	kArenaGranularity = 16,
+	kArenaSizeClasses = 16,
+	kArenaMaxSmallSize = kArenaGranularity * kArenaSizeClasses
+};
+
+struct ArenaStats {
+	uint32 allocCount;      ///< Blocks handed out, including moved reallocations
+	uint32 freeCount;       ///< Blocks given back
+	uint32 reallocInPlace;  ///< Reallocations that stayed in their size class
+	uint32 largeAllocCount; ///< Blocks too big for the arena, served by realloc()
+	size_t bytesInUse;      ///< Bytes requested by Lua and not yet freed
+	size_t peakBytesInUse;
+	size_t largeBytesInUse;
+	size_t chunkBytes;      ///< Memory reserved for the small block chunks
+	uint32 classBlocks[kArenaSizeClasses]; ///< Live blocks per size class
+};
+
+/**
+ * Creates a Lua state whose small allocations are carved out of per-state
+ * chunks, one free list per 16 byte size class. Blocks larger than
+ * kArenaMaxSmallSize go straight to realloc(). Freed small blocks are only
+ * recycled within the state; all chunks are returned at once when the state
+ * is closed with closeArenaState().
+ */
+lua_State *newArenaState();
+
+/**
+ * Closes a state created by newArenaState() and releases its arena.
+ */
+void closeArenaState(lua_State *L);
+
+/**
+ * Fills in the allocation statistics of a state created by newArenaState().
+ * Returns false if the state uses a different allocator.
+ */
+bool getArenaStats(lua_State *L, ArenaStats &stats);
+
+} // End of namespace Lua
+
+#endif
@@ -156,11 +156,8 @@ static void persist(SerializationInfo *info) {
 		// Write out a flag that indicates that it's an index
 		info->writeStream->writeByte(0);
 
-		// Retrieve the index from the stack
-		uint *index = (uint *)lua_touserdata(info->luaState, -1);
-
-		// Write out the index
-		info->writeStream->writeUint32LE(*index);
+		// Retrieve the index from the stack, and write it out
+		info->writeStream->writeUint32LE((uint32)lua_tonumber(info->luaState, -1));
 
 		// Pop the index off the stack
 		lua_pop(info->luaState, 1);
@@ -189,8 +186,9 @@ static void persist(SerializationInfo *info) {
 	lua_pushvalue(info->luaState, -1);
 	// >>>>> permTbl indexTbl rootObj ...... obj obj
 
-	uint *ref = (uint *)lua_newuserdata(info->luaState, sizeof(uint));
-	*ref = ++(info->counter);
+	// The index is stored as a plain number, so that recording an object
+	// doesn't need a garbage collected allocation of its own
+	lua_pushnumber(info->luaState, ++(info->counter));
 	// >>>>> permTbl indexTbl rootObj ...... obj obj index
 
 	lua_rawset(info->luaState, 2);
@@ -120,6 +120,30 @@ public:
 	int64 size() const override;
 };
 
+/**
+ * Header information of a save file, as kept in the metadata index of
+ * a SaveFileManager. This avoids having to open and decompress each save
+ * file again every time the saves are listed.
+ */
+struct SavefileMetadata {
+	bool hasHeader;      /*!< Whether the file has an extended savegame header. */
+	String description;  /*!< Description of the savegame. */
+	uint32 date;         /*!< Date of the savegame, encoded as in the header. */
+	uint16 time;         /*!< Time of the savegame, encoded as in the header. */
+	uint32 playtime;     /*!< Total play time until this savegame. */
+	bool isAutosave;     /*!< Whether this savegame is an autosave. */
+	int64 fileSize;      /*!< Raw size of the file, used to validate the entry. */
+
+	SavefileMetadata() {
+		hasHeader = false;
+		date = 0;
+		time = 0;
+		playtime = 0;
+		isAutosave = false;
+		fileSize = -1;
+	}
+};
+
 /**
  * The SaveFileManager serves as a factory for InSaveFile
  * and OutSaveFile objects.
@@ -276,6 +300,28 @@ public:
 	 * @return true if the file exists. false otherwise.
 	 */
 	virtual bool exists(const String &name) = 0;
+
+	/**
+	 * Look up the indexed header information of a save file.
+	 *
+	 * Entries are dropped when the file is written or removed through the
+	 * save file manager, and when its size changes.
+	 *
+	 * @param name      Name of the save file.
+	 * @param metadata  Receives the indexed information.
+	 *
+	 * @return true if valid information was found, false otherwise.
+	 */
+	virtual bool getSavefileMetadata(const String &name, SavefileMetadata &metadata) { return false; }
+
+	/**
+	 * Store the header information of a save file in the index.
+	 * Save file managers without an index ignore this.
+	 *
+	 * @param name      Name of the save file.
+	 * @param metadata  Information read from the file.
+	 */
+	virtual void setSavefileMetadata(const String &name, const SavefileMetadata &metadata) {}
 };
 
 /** @} */
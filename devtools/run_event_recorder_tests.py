@@ -14,6 +14,9 @@
 #   SDL_VIDEODRIVER=dummy SDL_AUDIODRIVER=dummy SCUMMVM_BIN=./scummvm \
 #   python3 devtools/run_event_recorder_tests.py --xunit-output=event_recorder_tests.xml \
 #   --filter="*monkey*"
+#
+# To use the records as a benchmark, pass --headless to skip all graphics output and
+# --profile-dir=DIR to get a CSV file with the real time spent on each frame per record.
 
 
 import os
@@ -61,6 +64,8 @@ def main():
 	parser.add_argument("-v", "--verbose", action="store_true", help="Enable verbose output", default=False)
 	parser.add_argument("--filter", help="Filter tests (glob pattern, e.g. *monkey*)", default="*")
 	parser.add_argument("--list", action="store_true", help="List tests", default=False)
+	parser.add_argument("--headless", action="store_true", help="Disable any graphics output during playback", default=False)
+	parser.add_argument("--profile-dir", help="Directory to write per-frame timing profiles to", default=None)
 	args = parser.parse_args()
 
 	# Configuration
@@ -206,9 +211,15 @@ def main():
 			playback_cmd = [
 				str(scummvm_bin),
 				"--record-mode=fast_playback",
-				f"--record-file-name={test['record_file']}",
-				test['target']
+				f"--record-file-name={test['record_file']}"
 			]
+			if args.headless:
+				playback_cmd.append("--disable-display")
+			if args.profile_dir:
+				profile_path = Path(args.profile_dir) / f"{test['record_file']}.csv"
+				profile_path.parent.mkdir(parents=True, exist_ok=True)
+				playback_cmd.append(f"--record-profile={profile_path}")
+			playback_cmd.append(test['target'])
 
 			# Run and capture output
 			if args.verbose:
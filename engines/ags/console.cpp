@@ -25,6 +25,7 @@
 #include "ags/shared/ac/sprite_cache.h"
 #include "ags/shared/gfx/allegro_bitmap.h"
 #include "ags/shared/script/cc_common.h"
+#include "ags/engine/gfx/ali_3d_scummvm.h"
 #include "graphics/palette.h"
 #include "image/png.h"
 
@@ -36,6 +37,7 @@ AGSConsole::AGSConsole(AGSEngine *vm) : GUI::Debugger(), _vm(vm), _logOutputTarg
 	registerCmd("ags_set_script_dump", WRAP_METHOD(AGSConsole, Cmd_SetScriptDump));
 	registerCmd("ags_sprite_info",   WRAP_METHOD(AGSConsole, Cmd_getSpriteInfo));
 	registerCmd("ags_sprite_dump",  WRAP_METHOD(AGSConsole, Cmd_dumpSprite));
+	registerCmd("ags_dirty_rects",  WRAP_METHOD(AGSConsole, Cmd_dirtyRects));
 
 	_logOutputTarget = new LogOutputTarget();
 	_agsDebuggerOutput = _GP(DbgMgr).RegisterOutput("ScummVMLog", _logOutputTarget, AGS3::AGS::Shared::kDbgMsg_None);
@@ -245,6 +247,44 @@ bool AGSConsole::Cmd_dumpSprite(int argc, const char **argv) {
 	return true;
 }
 
+bool AGSConsole::Cmd_dirtyRects(int argc, const char **argv) {
+	AGS3::AGS::Engine::ALSW::ScummVMRendererGraphicsDriver *driver =
+		dynamic_cast<AGS3::AGS::Engine::ALSW::ScummVMRendererGraphicsDriver *>(_G(gfxDriver));
+	if (!driver) {
+		debugPrintf("Graphics driver is not initialized\n");
+		return true;
+	}
+
+	if (argc != 2) {
+		debugPrintf("Usage: %s [on|off|show|hide|stats]\n", argv[0]);
+		debugPrintf("  on/off    - push only the changed screen regions, or the whole frame\n");
+		debugPrintf("  show/hide - outline the regions updated in each frame\n");
+		debugPrintf("  stats     - print statistics since the last reset, and reset them\n");
+		debugPrintf("Dirty rects are %s, overlay is %s\n", driver->GetDirtyRectsEnabled() ? "on" : "off",
+					driver->GetShowDirtyRects() ? "shown" : "hidden");
+		return true;
+	}
+
+	if (strcmp(argv[1], "on") == 0 || strcmp(argv[1], "off") == 0) {
+		driver->SetDirtyRectsEnabled(strcmp(argv[1], "on") == 0);
+		driver->ResetPresentStats();
+	} else if (strcmp(argv[1], "show") == 0 || strcmp(argv[1], "hide") == 0) {
+		driver->SetShowDirtyRects(strcmp(argv[1], "show") == 0);
+	} else if (strcmp(argv[1], "stats") == 0) {
+		const AGS3::AGS::Engine::ALSW::ALPresentStats &stats = driver->GetPresentStats();
+		const uint32 elapsed = g_system->getMillis() - stats.StartTime;
+		debugPrintf("Mode: %s\n", driver->GetDirtyRectsEnabled() ? "dirty rects" : "full frame");
+		debugPrintf("Frames: %u (%u unchanged) in %u ms, %.1f fps\n", stats.Frames, stats.UnchangedFrames,
+					elapsed, elapsed ? stats.Frames * 1000.0 / elapsed : 0.0);
+		debugPrintf("Pixels pushed: %.1f%% of total\n",
+					stats.TotalPixels ? stats.PushedPixels * 100.0 / stats.TotalPixels : 0.0);
+		driver->ResetPresentStats();
+	} else {
+		debugPrintf("Unknown option '%s'\n", argv[1]);
+	}
+	return true;
+}
+
 LogOutputTarget::LogOutputTarget() {
 }
 
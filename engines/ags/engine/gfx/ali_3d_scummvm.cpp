@@ -30,6 +30,7 @@
 #include "ags/engine/ac/timer.h"
 #include "ags/ags.h"
 #include "ags/globals.h"
+#include "graphics/blit.h"
 
 namespace AGS3 {
 namespace AGS {
@@ -40,6 +41,10 @@ using namespace Shared;
 
 static RGB faded_out_palette[256];
 
+// Max number of separate regions pushed to the screen per frame;
+// if there are more, they are merged into their bounding rectangle
+static const uint kMaxDirtyRegions = 16;
+
 
 // ----------------------------------------------------------------------------
 // ScummVMRendererGraphicsDriver
@@ -51,6 +56,7 @@ ScummVMRendererGraphicsDriver::ScummVMRendererGraphicsDriver() {
 	_tint_blue = 0;
 	virtualScreen = nullptr;
 	_stageVirtualScreen = nullptr;
+	_presentStats.StartTime = g_system->getMillis();
 }
 
 ScummVMRendererGraphicsDriver::~ScummVMRendererGraphicsDriver() {
@@ -134,6 +140,7 @@ bool ScummVMRendererGraphicsDriver::SetDisplayMode(const DisplayMode &mode) {
 
 	OnInit();
 	OnModeSet(mode);
+	InvalidateDeviceScreen();
 	return true;
 }
 
@@ -159,6 +166,7 @@ void ScummVMRendererGraphicsDriver::CreateVirtualScreen() {
 
 	_lastTexPixels = nullptr;
 	_lastTexPitch = -1;
+	InvalidateDeviceScreen();
 }
 
 void ScummVMRendererGraphicsDriver::DestroyVirtualScreen() {
@@ -191,6 +199,20 @@ void ScummVMRendererGraphicsDriver::ClearRectangle(int /*x1*/, int /*y1*/, int /
 	// See SDL_RenderDrawRect
 }
 
+void ScummVMRendererGraphicsDriver::InvalidateDeviceScreen() {
+	_fullPresentPending = true;
+}
+
+void ScummVMRendererGraphicsDriver::SetDirtyRectsEnabled(bool enabled) {
+	_dirtyRectsEnabled = enabled;
+	InvalidateDeviceScreen();
+}
+
+void ScummVMRendererGraphicsDriver::ResetPresentStats() {
+	_presentStats = ALPresentStats();
+	_presentStats.StartTime = g_system->getMillis();
+}
+
 void ScummVMRendererGraphicsDriver::UnInit() {
 	OnUnInit();
 	ReleaseDisplayMode();
@@ -501,36 +523,88 @@ size_t ScummVMRendererGraphicsDriver::RenderSpriteBatch(const ALSpriteBatch &bat
 	return from;
 }
 
-void ScummVMRendererGraphicsDriver::copySurface(const Graphics::Surface &src, bool mode) {
-	assert(src.w == _screen->w && src.h == _screen->h && src.pitch == _screen->pitch);
-	const uint32 *srcP = (const uint32 *)src.getPixels();
-	uint32 *destP = (uint32 *)_screen->getPixels();
-	uint32 pixel;
-	int x1 = 9999, y1 = 9999, x2 = -1, y2 = -1;
+void ScummVMRendererGraphicsDriver::drawDirtyRectsOverlay(const Common::Array<Common::Rect> &rects) {
+	// The outlines are only drawn on the temporary screen, so the next frame
+	// finds them changed and repaints them
+	const uint32 color = _screen->format.isCLUT8() ? 0xff : _screen->format.RGBToColor(0xff, 0, 0xff);
+	for (const auto &r : rects)
+		_screen->frameRect(r, color);
+}
+
+void ScummVMRendererGraphicsDriver::copySurface(const Graphics::Surface &src, RenderMode mode, Common::Array<Common::Rect> &rects) {
+	assert(src.w == _screen->w && src.h == _screen->h && mode != kRenderDirect);
+	const int bpp = _screen->format.bytesPerPixel;
+	const int rowSize = src.w * bpp;
+	_rowBuffer.resize(rowSize);
 
+	// Blit ignoring the alphas
+	Graphics::PixelFormat srcFormat = src.format;
+	srcFormat.aLoss = 8;
+
+	// Each converted row is compared with what the temporary screen holds from the
+	// last frame, and adjacent changed rows are merged into bands
+	Common::Rect band;
+	bool inBand = false;
 	for (int y = 0; y < src.h; ++y) {
-		for (int x = 0; x < src.w; ++x, ++srcP, ++destP) {
-			if (!mode) {
-				pixel = (*srcP & 0xff00ff00) |
-					((*srcP & 0xff) << 16) |
-					((*srcP >> 16) & 0xff);
-			} else {
-				pixel = ((*srcP & 0xffffff) << 8) |
-					((*srcP >> 24) & 0xff);
+		const byte *rowP = (const byte *)src.getBasePtr(0, y);
+		byte *destP = (byte *)_screen->getBasePtr(0, y);
+
+		if (mode == kRenderToABGR || mode == kRenderToRGBA) {
+			const uint32 *srcP = (const uint32 *)rowP;
+			uint32 *convP = (uint32 *)_rowBuffer.data();
+			for (int x = 0; x < src.w; ++x, ++srcP, ++convP) {
+				if (mode == kRenderToABGR) {
+					// ARGB to ABGR
+					*convP = (*srcP & 0xff00ff00) |
+						((*srcP & 0xff) << 16) |
+						((*srcP >> 16) & 0xff);
+				} else {
+					// ARGB to RGBA
+					*convP = ((*srcP & 0xffffff) << 8) |
+						((*srcP >> 24) & 0xff);
+				}
 			}
+			rowP = _rowBuffer.data();
+		} else {
+			Graphics::crossBlit(_rowBuffer.data(), rowP, rowSize, src.pitch, src.w, 1,
+				_screen->format, srcFormat);
+			rowP = _rowBuffer.data();
+		}
 
-			if (*destP != pixel) {
-				*destP = pixel;
-				x1 = MIN(x1, x);
-				y1 = MIN(y1, y);
-				x2 = MAX(x2, x);
-				y2 = MAX(y2, y);
+		if (memcmp(rowP, destP, rowSize) == 0) {
+			if (inBand) {
+				rects.push_back(band);
+				inBand = false;
 			}
+			continue;
+		}
+
+		int x1 = 0, x2 = src.w - 1;
+		while (memcmp(rowP + x1 * bpp, destP + x1 * bpp, bpp) == 0)
+			++x1;
+		while (memcmp(rowP + x2 * bpp, destP + x2 * bpp, bpp) == 0)
+			--x2;
+		memcpy(destP + x1 * bpp, rowP + x1 * bpp, (x2 - x1 + 1) * bpp);
+
+		if (inBand) {
+			band.left = MIN<int16>(band.left, x1);
+			band.right = MAX<int16>(band.right, x2 + 1);
+			band.bottom = y + 1;
+		} else {
+			band = Common::Rect(x1, y, x2 + 1, y + 1);
+			inBand = true;
 		}
 	}
+	if (inBand)
+		rects.push_back(band);
 
-	if (x2 != -1)
-		_screen->addDirtyRect(Common::Rect(x1, y1, x2 + 1, y2 + 1));
+	if (rects.size() > kMaxDirtyRegions) {
+		Common::Rect bounds = rects[0];
+		for (uint i = 1; i < rects.size(); ++i)
+			bounds.extend(rects[i]);
+		rects.clear();
+		rects.push_back(bounds);
+	}
 }
 
 void ScummVMRendererGraphicsDriver::Present(int xoff, int yoff, Shared::GraphicFlip flip) {
@@ -559,17 +633,14 @@ void ScummVMRendererGraphicsDriver::Present(int xoff, int yoff, Shared::GraphicF
 		*srcTransformed :
 		virtualScreen->GetAllegroBitmap()->getSurface();
 
-	enum {
-		kRenderInitial, kRenderDirect, kRenderToABGR, kRenderToRGBA,
-		kRenderOther
-	} renderMode;
+	RenderMode renderMode;
 
 	// Check for rendering to use. The virtual screen can change, so I'm
 	// playing it safe and checking the render mode for each frame
 	const Graphics::PixelFormat screenFormat = g_system->getScreenFormat();
 
 	if (src.format == screenFormat) {
-		// The virtual surface can be directly blitted to the screen
+		// The virtual surface can be directly copied to the screen
 		renderMode = kRenderDirect;
 	} else if (src.format != Graphics::PixelFormat(4, 8, 8, 8, 8, 16, 8, 0, 24)) {
 		// Not a 32-bit surface, so will have to use an intermediate
@@ -583,32 +654,12 @@ void ScummVMRendererGraphicsDriver::Present(int xoff, int yoff, Shared::GraphicF
 		renderMode = kRenderOther;
 	}
 
-	if (renderMode != kRenderDirect && !_screen)
-		_screen = new Graphics::Screen();
-
-	switch (renderMode) {
-	case kRenderToABGR:
-		// ARGB to ABGR
-		copySurface(src, false);
-		break;
-
-	case kRenderToRGBA:
-		// ARGB to RGBA
-		copySurface(src, true);
-		break;
-
-	case kRenderOther: {
-		// Blit the surface to the temporary screen, ignoring the alphas.
-		// This takes care of converting to the screen format
-		Graphics::Surface srcCopy = src;
-		srcCopy.format.aLoss = 8;
+	_presentStats.Frames++;
+	_presentStats.TotalPixels += src.w * src.h;
 
-		_screen->blitFrom(srcCopy);
-		break;
-	}
-
-	case kRenderDirect:
-		// Blit the virtual surface directly to the screen
+	if (renderMode == kRenderDirect) {
+		// Blit the virtual surface directly to the screen. Comparing it with
+		// the last frame would cost more than the copy it could save.
 		g_system->copyRectToScreen(src.getPixels(), src.pitch,
 			0, 0, src.w, src.h);
 		g_system->updateScreen();
@@ -616,19 +667,53 @@ void ScummVMRendererGraphicsDriver::Present(int xoff, int yoff, Shared::GraphicF
 			srcTransformed->free();
 			delete srcTransformed;
 		}
+
+		_presentStats.PushedPixels += src.w * src.h;
+		// The temporary screen no longer matches the device screen
+		_fullPresentPending = true;
 		return;
+	}
 
-	default:
-		break;
+	// The surface has to be converted anyway, so the temporary screen keeps
+	// the last frame in the screen format, and only the regions that differ
+	// from it are converted into it and pushed
+	if (_screen && (_screen->w != g_system->getWidth() || _screen->h != g_system->getHeight() ||
+			_screen->format != screenFormat)) {
+		delete _screen;
+		_screen = nullptr;
+	}
+	if (!_screen) {
+		_screen = new Graphics::Screen();
+		_fullPresentPending = true;
 	}
 
+	Common::Array<Common::Rect> dirtyRects;
+	copySurface(src, renderMode, dirtyRects);
+
 	if (srcTransformed) {
 		srcTransformed->free();
 		delete srcTransformed;
 	}
 
-	if (_screen)
-		_screen->update();
+	if (_fullPresentPending || !_dirtyRectsEnabled) {
+		// The device screen may not match the temporary screen
+		_screen->markAllDirty();
+		_fullPresentPending = false;
+		dirtyRects.clear();
+		dirtyRects.push_back(Common::Rect(_screen->w, _screen->h));
+	} else {
+		for (const auto &r : dirtyRects)
+			_screen->addDirtyRect(r);
+	}
+
+	if (dirtyRects.empty())
+		_presentStats.UnchangedFrames++;
+	for (const auto &r : dirtyRects)
+		_presentStats.PushedPixels += r.width() * r.height();
+
+	if (_showDirtyRects)
+		drawDirtyRectsOverlay(dirtyRects);
+	_screen->update();
 }
 
 void ScummVMRendererGraphicsDriver::Render(int xoff, int yoff, GraphicFlip flip) {
@@ -34,6 +34,8 @@
 #ifndef AGS_ENGINE_GFX_ALI_3D_SCUMMVM_H
 #define AGS_ENGINE_GFX_ALI_3D_SCUMMVM_H
 
+#include "common/array.h"
+#include "common/rect.h"
 #include "common/std/memory.h"
 #include "common/std/vector.h"
 #include "ags/shared/core/platform.h"
@@ -154,6 +156,19 @@ struct ALSpriteBatch {
 };
 typedef std::vector<ALSpriteBatch> ALSpriteBatches;
 
+// Statistics of the presented frames, for comparing full and dirty-region presentation
+struct ALPresentStats {
+	// Number of frames presented since the last reset
+	uint32_t Frames = 0u;
+	// Number of frames which had no changes at all
+	uint32_t UnchangedFrames = 0u;
+	// Pixels pushed to the screen, and pixels in the presented frames total
+	uint64_t PushedPixels = 0u;
+	uint64_t TotalPixels = 0u;
+	// Time of the last reset, in milliseconds
+	uint32_t StartTime = 0u;
+};
+
 
 class ScummVMRendererGraphicsDriver : public GraphicsDriverBase {
 public:
@@ -185,6 +200,7 @@ public:
 	void UnInit();
 	// Clears the screen rectangle. The coordinates are expected in the **native game resolution**.
 	void ClearRectangle(int x1, int y1, int x2, int y2, RGB *colorToUse) override;
+	void InvalidateDeviceScreen() override;
 	int  GetCompatibleBitmapFormat(int color_depth) override;
 	size_t GetAvailableTextureMemory() override {
 		// not using textures for sprites anyway
@@ -241,6 +257,16 @@ public:
 
 	void SetGraphicsFilter(PSDLRenderFilter filter);
 
+	// Sets whether only the changed regions of the frame are pushed to the screen;
+	// when disabled the whole frame is copied each time
+	void SetDirtyRectsEnabled(bool enabled);
+	bool GetDirtyRectsEnabled() const { return _dirtyRectsEnabled; }
+	// Sets whether the regions updated by the last frame are outlined on screen
+	void SetShowDirtyRects(bool show) { _showDirtyRects = show; }
+	bool GetShowDirtyRects() const { return _showDirtyRects; }
+	const ALPresentStats &GetPresentStats() const { return _presentStats; }
+	void ResetPresentStats();
+
 protected:
 	bool SetVsyncImpl(bool vsync, bool &vsync_res) override;
 	size_t GetLastDrawEntryIndex() override {
@@ -278,6 +304,19 @@ private:
 	Bitmap *_stageVirtualScreen;
 	int _tint_red, _tint_green, _tint_blue;
 
+	// Ways of getting the virtual screen pixels into the screen format
+	enum RenderMode {
+		kRenderDirect, kRenderToABGR, kRenderToRGBA, kRenderOther
+	};
+
+	// Whether the next frame must be pushed to the screen as a whole
+	bool _fullPresentPending = true;
+	bool _dirtyRectsEnabled = true;
+	bool _showDirtyRects = false;
+	// One virtual screen row converted to the screen format
+	Common::Array<byte> _rowBuffer;
+	ALPresentStats _presentStats;
+
 	// Sprite batches (parent scene nodes)
 	ALSpriteBatches _spriteBatches;
 	// List of sprites to render
@@ -298,8 +337,11 @@ private:
 	void highcolor_fade_out(Bitmap *vs, void(*draw_callback)(), int speed, int targetColourRed, int targetColourGreen, int targetColourBlue);
 	void __fade_from_range(PALETTE source, PALETTE dest, int speed, int from, int to);
 	void __fade_out_range(int speed, int from, int to, int targetColourRed, int targetColourGreen, int targetColourBlue);
-	// Copy raw screen bitmap pixels to the screen
-	void copySurface(const Graphics::Surface &src, bool mode);
+	// Outlines the updated regions on screen, for debugging purposes
+	void drawDirtyRectsOverlay(const Common::Array<Common::Rect> &rects);
+	// Copy raw screen bitmap pixels to the temporary screen, converting them to its
+	// format, and collect the regions which differ from the last frame
+	void copySurface(const Graphics::Surface &src, RenderMode mode, Common::Array<Common::Rect> &rects);
 	// Render bitmap on screen
 	void Present(int xoff = 0, int yoff = 0, Shared::GraphicFlip flip = Shared::kFlip_None);
 };
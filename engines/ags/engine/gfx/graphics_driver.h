@@ -143,6 +143,9 @@ public:
 	virtual void SetCallbackOnSpriteEvt(GFXDRV_CLIENTCALLBACKEVT callback) = 0;
 	// Clears the screen rectangle. The coordinates are expected in the **native game resolution**.
 	virtual void ClearRectangle(int x1, int y1, int x2, int y2, RGB *colorToUse) = 0;
+	// Tells the renderer that the device screen was painted over by something else
+	// (e.g. video playback), and must be fully repainted by the next Render call.
+	virtual void InvalidateDeviceScreen() = 0;
 	// Gets closest recommended bitmap format (currently - only color depth) for the given original format.
 	// Engine needs to have game bitmaps brought to the certain range of formats, easing conversion into the video bitmaps.
 	virtual int  GetCompatibleBitmapFormat(int color_depth) = 0;
@@ -137,7 +137,9 @@ static bool play_video(Video::VideoDecoder *decoder, const char *name, int flags
 		}
 	}
 
-	// Clear the screen after playback
+	// Clear the screen after playback; the renderer must repaint it whole,
+	// as the video was drawn directly to the screen
+	_G(gfxDriver)->InvalidateDeviceScreen();
 	if (_G(gfxDriver)->UsesMemoryBackBuffer())
 		_G(gfxDriver)->GetMemoryBackBuffer()->Clear();
 	render_to_screen();
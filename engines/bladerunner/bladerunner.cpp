@@ -1223,6 +1223,9 @@ void BladeRunnerEngine::gameTick() {
 		return;
 	}
 
+	bool measureTiming = _debugger->_dbgFrameTiming.enabled;
+	uint32 frameStart = measureTiming ? _system->getMillis() : 0;
+
 	_actorDialogueQueue->tick();
 	if (_scene->didPlayerWalkIn()) {
 		_sceneScript->playerWalkedIn();
@@ -1241,6 +1244,8 @@ void BladeRunnerEngine::gameTick() {
 
 	_ambientSounds->tick();
 
+	uint32 backgroundStart = measureTiming ? _system->getMillis() : 0;
+
 	bool backgroundChanged = false;
 	int frame = _scene->advanceFrame();
 	if (frame >= 0) {
@@ -1250,6 +1255,8 @@ void BladeRunnerEngine::gameTick() {
 	}
 	blit(_surfaceBack, _surfaceFront);
 
+	uint32 backgroundMillis = measureTiming ? _system->getMillis() - backgroundStart : 0;
+
 	_overlays->tick();
 
 	if (!inDialogueMenu) {
@@ -1264,6 +1271,8 @@ void BladeRunnerEngine::gameTick() {
 
 	_sliceRenderer->setView(_view);
 
+	uint32 actorsStart = measureTiming ? _system->getMillis() : 0;
+
 	// Tick and draw all actors in current set
 	int setId = _scene->getSetId();
 	for (int i = 0, end = _gameInfo->getActorCount(); i != end; ++i) {
@@ -1275,6 +1284,8 @@ void BladeRunnerEngine::gameTick() {
 		}
 	}
 
+	uint32 actorsMillis = measureTiming ? _system->getMillis() - actorsStart : 0;
+
 	_items->tick();
 
 	_itemPickup->tick();
@@ -1353,6 +1364,10 @@ void BladeRunnerEngine::gameTick() {
 	if (!_gameOver) {
 		blitToScreen(_surfaceFront);
 	}
+
+	if (measureTiming) {
+		_debugger->recordFrameTiming(backgroundMillis, actorsMillis, _system->getMillis() - frameStart);
+	}
 }
 
 void BladeRunnerEngine::actorsUpdate() {
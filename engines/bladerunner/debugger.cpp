@@ -114,6 +114,7 @@ Debugger::Debugger(BladeRunnerEngine *vm) : GUI::Debugger() {
 	_useAdditiveDrawModeForMouseCursorMode0 = false;
 	_useAdditiveDrawModeForMouseCursorMode1 = false;
 	resetPendingOuttake();
+	resetFrameTiming();
 
 	registerCmd("anim", WRAP_METHOD(Debugger, cmdAnimation));
 	registerCmd("health", WRAP_METHOD(Debugger, cmdHealth));
@@ -146,6 +147,7 @@ Debugger::Debugger(BladeRunnerEngine *vm) : GUI::Debugger() {
 	registerCmd("playvqa", WRAP_METHOD(Debugger, cmdPlayVqa));
 	registerCmd("ammo", WRAP_METHOD(Debugger, cmdAmmo));
 	registerCmd("cheat", WRAP_METHOD(Debugger, cmdCheatReport));
+	registerCmd("timing", WRAP_METHOD(Debugger, cmdTiming));
 #if BLADERUNNER_ORIGINAL_BUGS
 #else
 	registerCmd("effect", WRAP_METHOD(Debugger, cmdEffect));
@@ -3331,4 +3333,65 @@ bool Debugger::cmdCheatReport(int argc, const char** argv) {
 	return true;
 }
 
+/**
+* Collect how long each game frame takes to render.
+* Background is the scene VQA decode and copy, actors is the slice rendering
+* of all actors in the current set, and frame is the whole game tick.
+*/
+bool Debugger::cmdTiming(int argc, const char **argv) {
+	bool invalidSyntax = false;
+
+	if (argc == 2) {
+		Common::String argName = argv[1];
+		argName.toLowercase();
+		if (argName == "on") {
+			resetFrameTiming();
+			_dbgFrameTiming.enabled = true;
+		} else if (argName == "off") {
+			_dbgFrameTiming.enabled = false;
+		} else if (argName == "reset") {
+			bool enabled = _dbgFrameTiming.enabled;
+			resetFrameTiming();
+			_dbgFrameTiming.enabled = enabled;
+		} else {
+			invalidSyntax = true;
+		}
+	} else if (argc != 1) {
+		invalidSyntax = true;
+	}
+
+	if (invalidSyntax) {
+		debugPrintf("Show or control the frame timing statistics\n");
+		debugPrintf("Usage: %s [on|off|reset]\n", argv[0]);
+		return true;
+	}
+
+	debugPrintf("Frame timing = %s\n", _dbgFrameTiming.enabled ? "True" : "False");
+	if (_dbgFrameTiming.frames == 0) {
+		debugPrintf("No frames measured\n");
+		return true;
+	}
+
+	uint32 frames = _dbgFrameTiming.frames;
+	debugPrintf("Frames measured: %d\n", frames);
+	debugPrintf("Background: avg %.2f ms, max %d ms\n", (float)_dbgFrameTiming.backgroundTotal / frames, _dbgFrameTiming.backgroundMax);
+	debugPrintf("Actors:     avg %.2f ms, max %d ms\n", (float)_dbgFrameTiming.actorsTotal / frames, _dbgFrameTiming.actorsMax);
+	debugPrintf("Frame:      avg %.2f ms, max %d ms\n", (float)_dbgFrameTiming.frameTotal / frames, _dbgFrameTiming.frameMax);
+	return true;
+}
+
+void Debugger::resetFrameTiming() {
+	_dbgFrameTiming = DebuggerFrameTiming();
+}
+
+void Debugger::recordFrameTiming(uint32 backgroundMillis, uint32 actorsMillis, uint32 frameMillis) {
+	++_dbgFrameTiming.frames;
+	_dbgFrameTiming.backgroundTotal += backgroundMillis;
+	_dbgFrameTiming.actorsTotal += actorsMillis;
+	_dbgFrameTiming.frameTotal += frameMillis;
+	_dbgFrameTiming.backgroundMax = MAX(_dbgFrameTiming.backgroundMax, backgroundMillis);
+	_dbgFrameTiming.actorsMax = MAX(_dbgFrameTiming.actorsMax, actorsMillis);
+	_dbgFrameTiming.frameMax = MAX(_dbgFrameTiming.frameMax, frameMillis);
+}
+
 } // End of namespace BladeRunner
@@ -77,6 +77,19 @@ class Debugger : public GUI::Debugger {
 		DebuggerPendingOuttake() : pending(false), outtakeId(-1), notLocalized(true), container(-1), externalFilename("") {};
 	};
 
+	struct DebuggerFrameTiming {
+		bool   enabled;
+		uint32 frames;
+		uint32 backgroundTotal;
+		uint32 actorsTotal;
+		uint32 frameTotal;
+		uint32 backgroundMax;
+		uint32 actorsMax;
+		uint32 frameMax;
+
+		DebuggerFrameTiming() : enabled(false), frames(0), backgroundTotal(0), actorsTotal(0), frameTotal(0), backgroundMax(0), actorsMax(0), frameMax(0) {};
+	};
+
 public:
 	bool _isDebuggerOverlay;
 
@@ -103,6 +116,7 @@ public:
 	bool _useAdditiveDrawModeForMouseCursorMode0;
 	bool _useAdditiveDrawModeForMouseCursorMode1;
 	DebuggerPendingOuttake _dbgPendingOuttake;
+	DebuggerFrameTiming _dbgFrameTiming;
 
 	Debugger(BladeRunnerEngine *vm);
 	~Debugger() override;
@@ -143,6 +157,7 @@ public:
 #endif // BLADERUNNER_ORIGINAL_BUGS
 	bool cmdList(int argc, const char **argv);
 	bool cmdVk(int argc, const char **argv);
+	bool cmdTiming(int argc, const char **argv);
 
 	Common::String getDifficultyDescription(int difficultyValue);
 	Common::String getAmmoTypeDescription(int ammoType); 
@@ -159,6 +174,8 @@ public:
 
 	bool dbgAttemptToLoadChapterSetScene(int chapterId, int setId, int sceneId);
 	void resetPendingOuttake();
+	void resetFrameTiming();
+	void recordFrameTiming(uint32 backgroundMillis, uint32 actorsMillis, uint32 frameMillis);
 
 private:
 	Common::Array<DebuggerDrawnObject> _specificDrawnObjectsList;
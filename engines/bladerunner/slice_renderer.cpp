@@ -553,6 +553,18 @@ void SliceRenderer::drawSlice(int slice, bool advanced, int y, Graphics::Surface
 	uint32 polyCount = READ_LE_UINT32(p);
 	p += 4;
 
+	// Without screen effects the final colour of a span depends only on its
+	// palette entry, so it is computed once per entry for this line.
+	bool cacheColors = advanced && _screenEffects->_entries.empty();
+	if (cacheColors) {
+		memset(_lineColorCached, 0, sizeof(_lineColorCached));
+	}
+
+	// Every pixel of the slice lands on the same row, the lookup of the line is done once
+	byte *lineBase = (byte *)surface.getBasePtr(0, CLIP(y, 0, surface.h - 1));
+	int bytesPerPixel = surface.format.bytesPerPixel;
+	int maxX = surface.w - 1;
+
 	while (polyCount--) {
 		uint32 vertexCount = READ_LE_UINT32(p);
 		p += 4;
@@ -573,7 +585,9 @@ void SliceRenderer::drawSlice(int slice, bool advanced, int y, Graphics::Surface
 
 				if (vertexZ >= 0 && vertexZ < 65536) {
 					uint32 outColor = palette.value[p[2]];
-					if (advanced) {
+					if (cacheColors && _lineColorCached[p[2]]) {
+						outColor = _lineColorCache[p[2]];
+					} else if (advanced) {
 						Color256 aescColor = { 0, 0, 0 };
 						_screenEffects->getColor(&aescColor, vertexX, y, vertexZ);
 
@@ -583,13 +597,17 @@ void SliceRenderer::drawSlice(int slice, bool advanced, int y, Graphics::Surface
 						color.b = ((int)(_setEffectColor.b + _lightsColor.b * color.b) / 65536) + aescColor.b;
 						// We need to convert from 5 bits per channel (r,g,b) to 8 bits
 						outColor = _pixelFormat.RGBToColor(Color::get8BitColorFrom5Bit(color.r), Color::get8BitColorFrom5Bit(color.g), Color::get8BitColorFrom5Bit(color.b));
+						if (cacheColors) {
+							_lineColorCache[p[2]] = outColor;
+							_lineColorCached[p[2]] = true;
+						}
 					}
 
 					for (int x = previousVertexX; x != vertexX; ++x) {
 						if (vertexZ < zbufferLine[x]) {
 							zbufferLine[x] = (uint16)vertexZ;
 
-							void *dstPtr = surface.getBasePtr(CLIP(x, 0, surface.w - 1), CLIP(y, 0, surface.h - 1));
+							void *dstPtr = lineBase + CLIP(x, 0, maxX) * bytesPerPixel;
 							drawPixel(surface, dstPtr, outColor);
 						}
 					}
@@ -88,6 +88,9 @@ class SliceRenderer {
 	Color _setEffectColor;
 	Color _lightsColor;
 
+	uint32 _lineColorCache[256];
+	bool   _lineColorCached[256];
+
 	Graphics::PixelFormat _pixelFormat;
 
 public:
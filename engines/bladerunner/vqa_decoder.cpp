@@ -140,6 +140,7 @@ VQADecoder::VQADecoder() {
 	_header.unk5         = 0;
 	_readingFrame        = -1;
 	_decodingFrame       = -1;
+	_packetCacheSize     = 0;
 	_vqpPalsArr          = nullptr;
 	_numOfVQPPalettes    = 0;
 	_oldV2VQA                 = false;
@@ -159,6 +160,8 @@ void VQADecoder::close() {
 	}
 	_codebooks.clear();
 
+	clearPacketCache();
+
 	delete _audioTrack;
 	_audioTrack = nullptr;
 
@@ -256,34 +259,34 @@ void VQADecoder::decodeLights(Lights *lights) {
 	_videoTrack->decodeLights(lights);
 }
 
-void VQADecoder::readPacket(uint readFlags) {
+void VQADecoder::readPacket(Common::SeekableReadStream *s, uint readFlags) {
 	IFFChunkHeader chd;
 
-	if (remain(_s) < 8) {
-		warning("VQADecoder::readPacket(): remain: %d", remain(_s));
-		assert(remain(_s) < 8);
+	if (remain(s) < 8) {
+		warning("VQADecoder::readPacket(): remain: %d", remain(s));
+		assert(remain(s) < 8);
 	}
 
 	do {
-		if (!readIFFChunkHeader(_s, &chd)) {
+		if (!readIFFChunkHeader(s, &chd)) {
 			error("VQADecoder::readPacket(): Error reading chunk header");
 		}
 
 		bool rc = false;
 		// Video track
 		switch (chd.id) {
-		case kAESC: rc = ((readFlags & kVQAReadCustom) == 0) ? _s->skip(roundup(chd.size)) : _videoTrack->readAESC(_s, chd.size); break;
-		case kLITE: rc = ((readFlags & kVQAReadCustom) == 0) ? _s->skip(roundup(chd.size)) : _videoTrack->readLITE(_s, chd.size); break;
-		case kVIEW: rc = ((readFlags & kVQAReadCustom) == 0) ? _s->skip(roundup(chd.size)) : _videoTrack->readVIEW(_s, chd.size); break;
-		case kVQFL: rc = ((readFlags & kVQAReadVideo ) == 0) ? _s->skip(roundup(chd.size)) : _videoTrack->readVQFL(_s, chd.size, readFlags); break;
-		case kVQFR: rc = ((readFlags & kVQAReadVideo ) == 0) ? _s->skip(roundup(chd.size)) : _videoTrack->readVQFR(_s, chd.size, readFlags); break;
-		case kZBUF: rc = ((readFlags & kVQAReadCustom) == 0) ? _s->skip(roundup(chd.size)) : _videoTrack->readZBUF(_s, chd.size); break;
+		case kAESC: rc = ((readFlags & kVQAReadCustom) == 0) ? s->skip(roundup(chd.size)) : _videoTrack->readAESC(s, chd.size); break;
+		case kLITE: rc = ((readFlags & kVQAReadCustom) == 0) ? s->skip(roundup(chd.size)) : _videoTrack->readLITE(s, chd.size); break;
+		case kVIEW: rc = ((readFlags & kVQAReadCustom) == 0) ? s->skip(roundup(chd.size)) : _videoTrack->readVIEW(s, chd.size); break;
+		case kVQFL: rc = ((readFlags & kVQAReadVideo ) == 0) ? s->skip(roundup(chd.size)) : _videoTrack->readVQFL(s, chd.size, readFlags); break;
+		case kVQFR: rc = ((readFlags & kVQAReadVideo ) == 0) ? s->skip(roundup(chd.size)) : _videoTrack->readVQFR(s, chd.size, readFlags); break;
+		case kZBUF: rc = ((readFlags & kVQAReadCustom) == 0) ? s->skip(roundup(chd.size)) : _videoTrack->readZBUF(s, chd.size); break;
 		// Sound track
-		case kSN2J: rc = ((readFlags & kVQAReadAudio) == 0) ? _s->skip(roundup(chd.size)) : _audioTrack->readSN2J(_s, chd.size); break;
-		case kSND2: rc = ((readFlags & kVQAReadAudio) == 0) ? _s->skip(roundup(chd.size)) : _audioTrack->readSND2(_s, chd.size); break;
+		case kSN2J: rc = ((readFlags & kVQAReadAudio) == 0) ? s->skip(roundup(chd.size)) : _audioTrack->readSN2J(s, chd.size); break;
+		case kSND2: rc = ((readFlags & kVQAReadAudio) == 0) ? s->skip(roundup(chd.size)) : _audioTrack->readSND2(s, chd.size); break;
 		default:
 			rc = false;
-			_s->skip(roundup(chd.size));
+			s->skip(roundup(chd.size));
 		}
 
 		if (!rc) {
@@ -299,10 +302,65 @@ void VQADecoder::readFrame(int frame, uint readFlags) {
 	}
 
 	uint32 frameOffset = 2 * (_frameInfo[frame] & 0x0FFFFFFF);
-	_s->seek(frameOffset);
 
 	_readingFrame = frame;
-	readPacket(readFlags);
+
+	const PacketInfo *packet = getPacket(frame, frameOffset);
+	if (packet) {
+		Common::MemoryReadStream packetStream(packet->data, packet->size);
+		readPacket(&packetStream, readFlags);
+	} else {
+		_s->seek(frameOffset);
+		readPacket(_s, readFlags);
+	}
+}
+
+const VQADecoder::PacketInfo *VQADecoder::getPacket(int frame, uint32 frameOffset) {
+	for (uint i = 0; i < _packetCache.size(); ++i) {
+		if (_packetCache[i].frame == frame) {
+			return &_packetCache[i];
+		}
+	}
+
+	// A packet spans up to the start of the next frame
+	int32 packetEnd = (frame + 1 < numFrames()) ? 2 * (_frameInfo[frame + 1] & 0x0FFFFFFF) : _s->size();
+	if (packetEnd <= (int32)frameOffset || packetEnd > _s->size()) {
+		return nullptr;
+	}
+
+	uint32 packetSize = packetEnd - frameOffset;
+	if (packetSize > kPacketCacheBudget / 4) {
+		return nullptr;
+	}
+
+	PacketInfo packet;
+	packet.frame = frame;
+	packet.size  = packetSize;
+	packet.data  = new uint8[packetSize];
+
+	_s->seek(frameOffset);
+	if (_s->read(packet.data, packetSize) != packetSize) {
+		delete[] packet.data;
+		return nullptr;
+	}
+
+	while (!_packetCache.empty() && _packetCacheSize + packetSize > kPacketCacheBudget) {
+		_packetCacheSize -= _packetCache[0].size;
+		delete[] _packetCache[0].data;
+		_packetCache.remove_at(0);
+	}
+
+	_packetCache.push_back(packet);
+	_packetCacheSize += packetSize;
+	return &_packetCache.back();
+}
+
+void VQADecoder::clearPacketCache() {
+	for (uint i = 0; i < _packetCache.size(); ++i) {
+		delete[] _packetCache[i].data;
+	}
+	_packetCache.clear();
+	_packetCacheSize = 0;
 }
 
 bool VQADecoder::readVQHD(Common::SeekableReadStream *s, uint32 size) {
@@ -724,6 +782,8 @@ VQADecoder::VQAVideoTrack::VQAVideoTrack(VQADecoder *vqaDecoder) {
 
 	_zbufChunkSize = 0;
 	_zbufChunk     = new uint8[_maxZBUFChunkSize];
+	_zbufFrame     = -1;
+	_zbufCacheSize = 0;
 
 	_viewDataSize = 0;
 	_viewData     = nullptr;
@@ -754,6 +814,10 @@ VQADecoder::VQAVideoTrack::~VQAVideoTrack() {
 	delete[] _zbufChunk;
 	delete[] _vpointer;
 
+	for (uint i = 0; i < _zbufCache.size(); ++i) {
+		delete[] _zbufCache[i].data;
+	}
+
 	delete[] _viewData;
 	delete[] _screenEffectsData;
 	delete[] _lightsData;
@@ -938,6 +1002,7 @@ bool VQADecoder::VQAVideoTrack::readZBUF(Common::SeekableReadStream *s, uint32 s
 	}
 
 	_zbufChunkSize = size;
+	_zbufFrame = _vqaDecoder->_readingFrame;
 	s->read(_zbufChunk, roundedSize);
 
 	return true;
@@ -948,7 +1013,42 @@ void VQADecoder::VQAVideoTrack::decodeZBuffer(ZBuffer *zbuffer) {
 		return;
 	}
 
-	zbuffer->decodeData(_zbufChunk, _zbufChunkSize);
+	// Partial z-buffers are applied over the previous one, so only complete
+	// ones can be reused
+	const bool complete = _zbufChunkSize >= 16 && READ_LE_UINT32(_zbufChunk + 8) != 0;
+	const int width  = complete ? READ_LE_UINT32(_zbufChunk + 0) : 0;
+	const int height = complete ? READ_LE_UINT32(_zbufChunk + 4) : 0;
+	if (complete) {
+		for (uint i = 0; i < _zbufCache.size(); ++i) {
+			if (_zbufCache[i].frame == _zbufFrame) {
+				zbuffer->setData(_zbufCache[i].data, width, height);
+				return;
+			}
+		}
+	}
+
+	if (!zbuffer->decodeData(_zbufChunk, _zbufChunkSize) || !complete) {
+		return;
+	}
+
+	uint32 size = 2 * width * height;
+	if (size > kZBufferCacheBudget) {
+		return;
+	}
+
+	while (!_zbufCache.empty() && _zbufCacheSize + size > kZBufferCacheBudget) {
+		_zbufCacheSize -= _zbufCache[0].size;
+		delete[] _zbufCache[0].data;
+		_zbufCache.remove_at(0);
+	}
+
+	ZBufferInfo info;
+	info.frame = _zbufFrame;
+	info.size  = size;
+	info.data  = new uint16[width * height];
+	memcpy(info.data, zbuffer->getData(), size);
+	_zbufCache.push_back(info);
+	_zbufCacheSize += size;
 }
 
 bool VQADecoder::VQAVideoTrack::readVIEW(Common::SeekableReadStream *s, uint32 size) {
@@ -1146,22 +1246,24 @@ void VQADecoder::VQAVideoTrack::VPTRWriteBlock(Graphics::Surface *surface, unsig
 
 	uint16 blocks_per_line = _width / _blockW;
 
-	uint32 intermDiv = 0;
-	uint32 dst_x = 0;
-	uint32 dst_y = 0;
+	// Position of the first block, the following ones are reached by stepping along the block line
+	uint32 block_x = dstBlock % blocks_per_line;
+	uint32 block_y = dstBlock / blocks_per_line;
+	uint8 *linePtr = (uint8 *)surface->getBasePtr(_offsetX, block_y * _blockH + _offsetY);
 
 	for (uint i = count; i != 0; --i) {
-		intermDiv = (dstBlock + count - i) / blocks_per_line; // start of current blocks line
-		dst_x = ((dstBlock + count - i) - intermDiv * blocks_per_line) * _blockW + _offsetX;
-		dst_y = intermDiv * _blockH + _offsetY;
-
-		uint8* dstPtr = (uint8 *)surface->getBasePtr(dst_x, dst_y);
+		uint8* dstPtr = linePtr + block_x * _blockW * bpp;
 		if (alpha) {
 			// Use mask to blit
 			Graphics::maskBlit(dstPtr, block_src, mask_src, surface->pitch, _blockW * bpp, _blockW, _blockW, _blockH, bpp);
 		} else {
 			Graphics::copyBlit(dstPtr, block_src, surface->pitch, _blockW * bpp, _blockW, _blockH, bpp);
 		}
+
+		if (++block_x == blocks_per_line) {
+			block_x = 0;
+			linePtr += _blockH * surface->pitch;
+		}
 	}
 }
 
@@ -154,6 +154,14 @@ public:
 		uint8  *data;
 	};
 
+	struct PacketInfo {
+		int     frame;
+		uint32  size;
+		uint8  *data;
+	};
+
+	static const uint32 kPacketCacheBudget = 2 * 1024 * 1024;
+
 	class VQAVideoTrack;
 	class VQAAudioTrack;
 
@@ -176,6 +184,11 @@ public:
 	bool        _centerVideoRequested;
 	Common::Array<CodebookInfo> _codebooks;
 
+	// Raw packets of the last frames read, oldest first. Looping backgrounds and
+	// the audio read-ahead can then parse a frame again without going back to the archive.
+	Common::Array<PacketInfo> _packetCache;
+	uint32                    _packetCacheSize;
+
 	uint32  *_frameInfo;
 
 	uint32   _maxVIEWChunkSize;
@@ -185,7 +198,9 @@ public:
 	VQAVideoTrack *_videoTrack;
 	VQAAudioTrack *_audioTrack;
 
-	void readPacket(uint readFlags);
+	void readPacket(Common::SeekableReadStream *s, uint readFlags);
+	const PacketInfo *getPacket(int frame, uint32 frameOffset);
+	void clearPacketCache();
 
 	bool readVQHD(Common::SeekableReadStream *s, uint32 size);
 	bool readMSCI(Common::SeekableReadStream *s, uint32 size);
@@ -200,6 +215,13 @@ public:
 
 	class VQAVideoTrack {
 		static const uint     kSizeInBytesOfCPL0Chunk = 768; // 3 * 256
+		static const uint32   kZBufferCacheBudget = 4 * 1024 * 1024;
+
+		struct ZBufferInfo {
+			int     frame;
+			uint32  size;
+			uint16 *data;
+		};
 	public:
 		VQAVideoTrack(VQADecoder *vqaDecoder);
 		~VQAVideoTrack();
@@ -255,6 +277,12 @@ public:
 		uint8   *_cbfz;
 		uint32   _zbufChunkSize;
 		uint8   *_zbufChunk;
+		int      _zbufFrame;
+
+		// Complete z-buffers decoded last, oldest first. They only depend on
+		// their chunk, so looping backgrounds do not decompress them again.
+		Common::Array<ZBufferInfo> _zbufCache;
+		uint32                     _zbufCacheSize;
 
 		uint32   _vpointerSize;
 		uint8   *_vpointer;
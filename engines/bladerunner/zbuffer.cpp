@@ -174,6 +174,24 @@ bool ZBuffer::decodeData(const uint8 *data, int size) {
 	return true;
 }
 
+bool ZBuffer::setData(const uint16 *data, int width, int height) {
+	if (_disabled) {
+		return false;
+	}
+
+	if (width != _width || height != _height) {
+		warning("zbuffer size mismatch (%d, %d) != (%d, %d)", _width, _height, width, height);
+		return false;
+	}
+
+	// Same as decoding complete data
+	resetUpdates();
+	memcpy(_zbuf1, data, 2 * _width * _height);
+	memcpy(_zbuf2, _zbuf1, 2 * _width * _height);
+
+	return true;
+}
+
 uint16 *ZBuffer::getData() const {
 	return _zbuf2;
 }
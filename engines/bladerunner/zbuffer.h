@@ -63,6 +63,7 @@ public:
 
 	void init(int width, int height);
 	bool decodeData(const uint8 *data, int size);
+	bool setData(const uint16 *data, int width, int height);
 
 	uint16 *getData() const;
 	uint16 getZValue(int x, int y) const;
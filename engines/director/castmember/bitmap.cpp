@@ -43,10 +43,13 @@
 
 namespace Director {
 
+static uint32 s_pictureVersion = 0;
+
 BitmapCastMember::BitmapCastMember(Cast *cast, uint16 castId, Common::SeekableReadStreamEndian &stream, uint32 castTag, uint16 version, uint8 flags1)
 		: CastMember(cast, castId, stream) {
 	_type = kCastBitmap;
 	_picture = new Picture();
+	_pictureVersion = ++s_pictureVersion;
 	_ditheredImg = nullptr;
 	_matte = nullptr;
 	_noMatte = false;
@@ -250,6 +253,7 @@ BitmapCastMember::BitmapCastMember(Cast *cast, uint16 castId, Image::ImageDecode
 	if (img != nullptr) {
 		_picture = new Picture(*img);
 	}
+	_pictureVersion = ++s_pictureVersion;
 	_ditheredImg = nullptr;
 	_clut = CastMemberID(0, 0);
 	_ditheredTargetClut = CastMemberID(0, 0);
@@ -281,6 +285,7 @@ BitmapCastMember::BitmapCastMember(Cast *cast, uint16 castId, BitmapCastMember &
 		_children = source._children;
 
 	_picture = source._picture ? new Picture(*source._picture) : nullptr;
+	_pictureVersion = ++s_pictureVersion;
 	_ditheredImg = nullptr;
 	_matte = nullptr;
 
@@ -686,6 +691,8 @@ void BitmapCastMember::load() {
 	}
 
 	_needsReload = false;
+	_pictureReplaced = false;
+	_pictureVersion = ++s_pictureVersion;
 
 	uint32 tag = _tag;
 	uint16 imgId = _castId;
@@ -859,6 +866,7 @@ void BitmapCastMember::unload() {
 
 	delete _picture;
 	_picture = new Picture();
+	_pictureVersion = ++s_pictureVersion;
 
 	if (_ditheredImg) {
 		_ditheredImg->free();
@@ -880,9 +888,20 @@ PictureReference *BitmapCastMember::getPicture() const {
 	return picture;
 }
 
+uint32 BitmapCastMember::getDecodedSize() const {
+	// A picture set from Lingo can't be decoded again
+	if (!_loaded || _pictureReplaced || !_picture)
+		return 0;
+
+	const Graphics::Surface &surface = _picture->_surface;
+	return surface.pitch * surface.h;
+}
+
 void BitmapCastMember::setPicture(PictureReference &picture) {
 	delete _picture;
 	_picture = new Picture(*picture._picture);
+	_pictureReplaced = true;
+	_pictureVersion = ++s_pictureVersion;
 
 	// Force redither
 	if (_ditheredImg) {
@@ -899,6 +918,7 @@ void BitmapCastMember::setPicture(PictureReference &picture) {
 void BitmapCastMember::setPicture(Image::ImageDecoder &image, bool adjustSize) {
 	delete _picture;
 	_picture = new Picture(image);
+	_pictureVersion = ++s_pictureVersion;
 	if (adjustSize) {
 		auto surf = image.getSurface();
 		_size = surf->pitch * surf->h + _picture->getPaletteSize();
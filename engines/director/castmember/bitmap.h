@@ -56,6 +56,9 @@ public:
 	void load() override;
 	void unload() override;
 
+	// Memory used by the decoded image, if it can be reloaded from the movie
+	uint32 getDecodedSize() const;
+
 	PictureReference *getPicture() const;
 	void setPicture(PictureReference &picture);
 	void setPicture(Image::ImageDecoder &image, bool adjustSize);
@@ -73,6 +76,10 @@ public:
 	uint32 getBITDResourceSize();
 
 	Picture *_picture = nullptr;
+	bool _pictureReplaced = false;
+	// Changes whenever _picture is replaced, and is never reused by another
+	// member, so it can identify the picture in caches
+	uint32 _pictureVersion = 0;
 	Graphics::Surface *_ditheredImg;
 	Graphics::Surface *_matte;
 
@@ -61,6 +61,9 @@ public:
 	virtual void unload();
 	bool isLoaded() { return _loaded; }
 
+	// Mac ticks of the last frame the member was seen on stage, for the cast cache
+	uint32 _lastOnStage = 0;
+
 	virtual bool isEditable() { return false; }
 	virtual void setEditable(bool editable) {}
 	virtual bool isModified() { return _modified; }
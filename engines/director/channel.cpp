@@ -50,6 +50,8 @@ Channel::Channel(Score *sc, Sprite *sp, int priority) {
 	_widget = nullptr;
 	_constraint = 0;
 	_mask = nullptr;
+	_maskMember = nullptr;
+	_maskVersion = 0;
 
 	_priority = priority;
 
@@ -86,6 +88,8 @@ Channel& Channel::operator=(const Channel &channel) {
 	_widget = nullptr;
 	_constraint = channel._constraint;
 	_mask = nullptr;
+	_maskMember = nullptr;
+	_maskVersion = 0;
 
 	_priority = channel._priority;
 
@@ -241,18 +245,28 @@ const Graphics::Surface *Channel::getMask(bool forceMatte) {
 				return nullptr;
 			}
 
-			if (_mask) {
-				delete _mask;
-				_mask = nullptr;
-			}
 			if (bitmap->_picture) {
 				// reposition channel bounding box, so origin is at registration offset
 				Common::Point originPos = getPosition();
 				bbox.translate(-originPos.x, -originPos.y);
-				// create new mask surface, with the exact dimensions of the channel.
-				_mask = new Graphics::ManagedSurface(bbox.width(), bbox.height());
+
 				// get the bounding box of the mask image (origin at registration offset)
 				Common::Rect destRect = bitmap->getBbox();
+
+				// The mask only changes with the mask picture, its registration
+				// point or the sprite size, so keep it between blits instead of
+				// rebuilding it for each one
+				if (_mask && _maskMember == bitmap && _maskVersion == bitmap->_pictureVersion &&
+						_maskSrcBbox == destRect && _maskBbox == bbox)
+					return &_mask->rawSurface();
+
+				delete _mask;
+				_maskMember = bitmap;
+				_maskVersion = bitmap->_pictureVersion;
+				_maskSrcBbox = destRect;
+				_maskBbox = bbox;
+				// create new mask surface, with the exact dimensions of the channel.
+				_mask = new Graphics::ManagedSurface(bbox.width(), bbox.height());
 				// get position of channel's registration offset (origin at top left)
 				Common::Point channelRegOffset(-bbox.left, -bbox.top);
 				// move destination rect to sit at the channel's registration offset
@@ -33,6 +33,7 @@ namespace Graphics {
 
 namespace Director {
 
+class BitmapCastMember;
 class Sprite;
 class Cursor;
 class Score;
@@ -114,6 +115,12 @@ public:
 	bool _hideFromStage; // Used in DT for hiding the channel from rendering
 	uint _constraint;
 	Graphics::ManagedSurface *_mask;
+	// Source of the cached mask ink surface: the mask member and its picture
+	// version, its bbox and the channel bbox, relative to the registration point
+	const BitmapCastMember *_maskMember;
+	uint32 _maskVersion;
+	Common::Rect _maskSrcBbox;
+	Common::Rect _maskBbox;
 
 	int _priority;
 
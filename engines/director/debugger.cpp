@@ -118,6 +118,7 @@ Debugger::Debugger(): GUI::Debugger() {
 
 	registerCmd("draw", WRAP_METHOD(Debugger, cmdDraw));
 	registerCmd("forceredraw", WRAP_METHOD(Debugger, cmdForceRedraw));
+	registerCmd("castcache", WRAP_METHOD(Debugger, cmdCastCache));
 
 	_nextFrame = false;
 	_nextFrameCounter = 0;
@@ -202,7 +203,8 @@ bool Debugger::cmdHelp(int argc, const char **argv) {
 	debugPrintf(" bplist - Lists all breakpoints\n");
 	debugPrintf("\n");
 	debugPrintf("GFX:\n");
-	debugPrintf(" draw [cast|frame|off] - Draws debug outlines for cast or frame number\n");
+	debugPrintf(" draw [cast|frame|dirty|off] - Draws debug outlines for cast, frame number or redrawn areas\n");
+	debugPrintf(" castcache [budget <KB>|reset] - Shows the decoded cast size, sets its budget (0 disables it) or resets the counters\n");
 	return true;
 }
 
@@ -1043,10 +1045,12 @@ bool Debugger::cmdDraw(int argc, const char **argv) {
 				g_director->_debugDraw |= kDebugDrawCast;
 			} else if (!strncmp(argv[i], "frame", 5)) { // allow "frameS"
 				g_director->_debugDraw |= kDebugDrawFrame;
+			} else if (!scumm_stricmp(argv[i], "dirty")) {
+				g_director->_debugDraw |= kDebugDrawDirty;
 			} else if (!scumm_stricmp(argv[i], "all")) {
-				g_director->_debugDraw |= kDebugDrawCast | kDebugDrawFrame;
+				g_director->_debugDraw |= kDebugDrawCast | kDebugDrawFrame | kDebugDrawDirty;
 			} else {
-				debugPrintf("Valid parameters are 'cast', 'frame', 'all' or 'off'.\n");
+				debugPrintf("Valid parameters are 'cast', 'frame', 'dirty', 'all' or 'off'.\n");
 				return true;
 			}
 		}
@@ -1063,6 +1067,9 @@ bool Debugger::cmdDraw(int argc, const char **argv) {
 	if (g_director->_debugDraw & kDebugDrawFrame)
 		debugPrintf("frame ");
 
+	if (g_director->_debugDraw & kDebugDrawDirty)
+		debugPrintf("dirty ");
+
 	if (!g_director->_debugDraw)
 		debugPrintf("off ");
 
@@ -1102,6 +1109,28 @@ bool Debugger::cmdForceRedraw(int argc, const char **argv) {
 	return true;
 }
 
+bool Debugger::cmdCastCache(int argc, const char **argv) {
+	if (argc == 3 && !strcmp(argv[1], "budget")) {
+		g_director->_castCacheBudget = atoi(argv[2]) * 1024;
+	} else if (argc == 2 && !strcmp(argv[1], "reset")) {
+		g_director->_castPreloads = 0;
+		g_director->_castEvictions = 0;
+	} else if (argc != 1) {
+		debugPrintf("Usage: %s [budget <KB>|reset]\n", argv[0]);
+		return true;
+	}
+
+	Score *score = g_director->getCurrentMovie()->getScore();
+	if (g_director->_castCacheBudget)
+		debugPrintf("Budget: %d KB\n", g_director->_castCacheBudget / 1024);
+	else
+		debugPrintf("Budget: unlimited\n");
+	debugPrintf("Decoded bitmaps: %d KB\n", score->getDecodedCastSize() / 1024);
+	debugPrintf("Members decoded ahead: %d\n", g_director->_castPreloads);
+	debugPrintf("Members evicted: %d\n", g_director->_castEvictions);
+	return true;
+}
+
 void Debugger::bpUpdateState() {
 	_bpCheckFunc = false;
 	_bpCheckMoviePath = false;
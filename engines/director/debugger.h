@@ -130,6 +130,7 @@ private:
 
 	bool cmdDraw(int argc, const char **argv);
 	bool cmdForceRedraw(int argc, const char **argv);
+	bool cmdCastCache(int argc, const char **argv);
 
 	void bpUpdateState();
 	void bpTest(bool forceCheck = false);
@@ -117,6 +117,9 @@ DirectorEngine::DirectorEngine(OSystem *syst, const DirectorGameDescription *gam
 
 	_gameDataDir = Common::FSNode(ConfMan.getPath("path"));
 
+	if (ConfMan.hasKey("cast_cache_kb"))
+		_castCacheBudget = ConfMan.getInt("cast_cache_kb") * 1024;
+
 	SearchMan.addDirectory(_gameDataDir, 0, 5);
 
 	for (uint i = 0; Director::directoryGlobs[i]; i++) {
@@ -266,6 +266,11 @@ public:
 	uint32 _debugDraw = 0;
 	int _defaultVolume = 255;
 
+	// Memory ceiling for decoded cast bitmaps in bytes, 0 for no limit
+	uint32 _castCacheBudget = 0;
+	uint32 _castPreloads = 0;
+	uint32 _castEvictions = 0;
+
 public:
 	int _colorDepth;
 	Common::HashMap<int, int> _KeyCodes;
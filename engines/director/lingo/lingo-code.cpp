@@ -517,8 +517,9 @@ void LC::c_proparraypush() {
 
 void LC::c_globalinit() {
 	Common::String name(g_lingo->readString());
-	if (!g_lingo->_globalvars.contains(name) || g_lingo->_globalvars[name].type == VOID) {
-		g_lingo->_globalvars[name] = Datum(0);
+	Datum &var = g_lingo->_globalvars.getOrCreateVal(name);
+	if (var.type == VOID) {
+		var = Datum(0);
 	}
 }
 
@@ -551,27 +552,23 @@ void LC::c_proprefpush() {
 }
 
 void LC::c_varpush() {
-	LC::c_varrefpush();
-	Datum d = g_lingo->pop();
-	g_lingo->push(g_lingo->varFetch(d));
+	Common::String name(g_lingo->readString());
+	g_lingo->push(g_lingo->fetchVariable(VARREF, name));
 }
 
 void LC::c_globalpush() {
-	LC::c_globalrefpush();
-	Datum d = g_lingo->pop();
-	g_lingo->push(g_lingo->varFetch(d));
+	Common::String name(g_lingo->readString());
+	g_lingo->push(g_lingo->fetchVariable(GLOBALREF, name));
 }
 
 void LC::c_localpush() {
-	LC::c_localrefpush();
-	Datum d = g_lingo->pop();
-	g_lingo->push(g_lingo->varFetch(d));
+	Common::String name(g_lingo->readString());
+	g_lingo->push(g_lingo->fetchVariable(LOCALREF, name));
 }
 
 void LC::c_proppush() {
-	LC::c_proprefpush();
-	Datum d = g_lingo->pop();
-	g_lingo->push(g_lingo->varFetch(d));
+	Common::String name(g_lingo->readString());
+	g_lingo->push(g_lingo->fetchVariable(PROPREF, name));
 }
 
 void LC::c_stackpeek() {
@@ -910,26 +910,31 @@ int Lingo::getAlignedType(const Datum &d1, const Datum &d2, bool equality) {
 Datum::Datum() {
 	u.s = nullptr;
 	type = VOID;
-	refCount = new int;
-	*refCount = 1;
+	refCount = nullptr;
 	ignoreGlobal = false;
 }
 
 Datum::Datum(const Datum &d) {
 	type = d.type;
 	u = d.u;
+	if (!d.hasInlineValue())
+		d.ensureRefCount();
 	refCount = d.refCount;
-	*refCount += 1;
+	if (refCount)
+		*refCount += 1;
 	ignoreGlobal = false;
 }
 
 Datum& Datum::operator=(const Datum &d) {
-	if (this != &d && refCount != d.refCount) {
+	if (this != &d && (!refCount || refCount != d.refCount)) {
 		reset();
 		type = d.type;
 		u = d.u;
+		if (!d.hasInlineValue())
+			d.ensureRefCount();
 		refCount = d.refCount;
-		*refCount += 1;
+		if (refCount)
+			*refCount += 1;
 	}
 	ignoreGlobal = false;
 	return *this;
@@ -938,16 +943,14 @@ Datum& Datum::operator=(const Datum &d) {
 Datum::Datum(int val) {
 	u.i = val;
 	type = INT;
-	refCount = new int;
-	*refCount = 1;
+	refCount = nullptr;
 	ignoreGlobal = false;
 }
 
 Datum::Datum(double val) {
 	u.f = val;
 	type = FLOAT;
-	refCount = new int;
-	*refCount = 1;
+	refCount = nullptr;
 	ignoreGlobal = false;
 }
 
@@ -967,8 +970,7 @@ Datum::Datum(AbstractObject *val) {
 		*refCount += 1;
 	} else {
 		type = VOID;
-		refCount = new int;
-		*refCount = 1;
+		refCount = nullptr;
 	}
 	ignoreGlobal = false;
 }
@@ -981,8 +983,7 @@ Datum::Datum(CastMember *val) {
 		*refCount += 1;
 	} else {
 		type = VOID;
-		refCount = new int;
-		*refCount = 1;
+		refCount = nullptr;
 	}
 	ignoreGlobal = false;
 }
@@ -1017,9 +1018,36 @@ Datum::Datum(const Common::Rect &rect) {
 	ignoreGlobal = false;
 }
 
+bool Datum::hasInlineValue() const {
+	switch (type) {
+	case VOID:
+	case INT:
+	case FLOAT:
+	case ARGC:
+	case ARGCNORET:
+	case CASTLIBREF:
+	case SPRITEREF:
+		return true;
+	default:
+		return false;
+	}
+}
+
+void Datum::ensureRefCount() const {
+	// A payload stored into a plain value after construction is owned
+	// by this Datum alone until it gets copied
+	if (!refCount) {
+		refCount = new int;
+		*refCount = 1;
+	}
+}
+
 void Datum::reset() {
-	if (!refCount)
-		return;
+	if (!refCount) {
+		if (hasInlineValue())
+			return;
+		ensureRefCount();
+	}
 
 	*refCount -= 1;
 	// Coverity thinks that we always free memory, as it assumes
@@ -1734,15 +1762,17 @@ int Lingo::getInt(uint pc) {
 	return (int)READ_UINT32(&((*_state->script)[pc]));
 }
 
-void Lingo::varAssign(const Datum &var, const Datum &value) {
-	switch (var.type) {
+void Lingo::assignVariable(DatumType refType, const Common::String &name, const Datum &value) {
+	switch (refType) {
 	case VARREF:
 		{
-			Common::String name = *var.u.s;
-			if (_state->localVars && _state->localVars->contains(name)) {
-				(*_state->localVars)[name] = value;
-				g_debugger->varWriteHook(name);
-				return;
+			if (_state->localVars) {
+				DatumHash::iterator it = _state->localVars->find(name);
+				if (it != _state->localVars->end()) {
+					it->_value = value;
+					g_debugger->varWriteHook(name);
+					return;
+				}
 			}
 			if (_state->me.type == OBJECT && _state->me.u.obj->hasProp(name)) {
 				_state->me.u.obj->setProp(name, value);
@@ -1758,23 +1788,24 @@ void Lingo::varAssign(const Datum &var, const Datum &value) {
 		// in Lscr, unlike globals declared outside of a handler and every other variable type.
 		// So while we require other variable types to be initialized before assigning to them,
 		// let's not enforce that for globals.
-		_globalvars[*var.u.s] = value;
-		g_debugger->varWriteHook(*var.u.s);
+		_globalvars[name] = value;
+		g_debugger->varWriteHook(name);
 		break;
 	case LOCALREF:
 		{
-			Common::String name = *var.u.s;
-			if (_state->localVars && _state->localVars->contains(name)) {
-				(*_state->localVars)[name] = value;
-				g_debugger->varWriteHook(name);
-			} else {
-				warning("varAssign: local variable %s not defined", name.c_str());
+			if (_state->localVars) {
+				DatumHash::iterator it = _state->localVars->find(name);
+				if (it != _state->localVars->end()) {
+					it->_value = value;
+					g_debugger->varWriteHook(name);
+					return;
+				}
 			}
+			warning("varAssign: local variable %s not defined", name.c_str());
 		}
 		break;
 	case PROPREF:
 		{
-			Common::String name = *var.u.s;
 			if (_state->me.type == OBJECT && _state->me.u.obj->hasProp(name)) {
 				_state->me.u.obj->setProp(name, value);
 				g_debugger->varWriteHook(name);
@@ -1783,6 +1814,20 @@ void Lingo::varAssign(const Datum &var, const Datum &value) {
 			}
 		}
 		break;
+	default:
+		warning("varAssign: assignment to non-variable");
+		break;
+	}
+}
+
+void Lingo::varAssign(const Datum &var, const Datum &value) {
+	switch (var.type) {
+	case VARREF:
+	case GLOBALREF:
+	case LOCALREF:
+	case PROPREF:
+		assignVariable(var.type, *var.u.s, value);
+		break;
 	case FIELDREF:
 	case CASTREF:
 		{
@@ -1849,24 +1894,25 @@ void Lingo::varAssign(const Datum &var, const Datum &value) {
 	}
 }
 
-Datum Lingo::varFetch(const Datum &var, bool silent) {
+Datum Lingo::fetchVariable(DatumType refType, const Common::String &name, bool silent) {
 	Datum result;
 
-	switch (var.type) {
+	switch (refType) {
 	case VARREF:
 		{
-			Datum d;
-			Common::String name = *var.u.s;
 			g_debugger->varReadHook(name);
 
-			if (_state->localVars && _state->localVars->contains(name)) {
-				return (*_state->localVars)[name];
+			if (_state->localVars) {
+				DatumHash::iterator it = _state->localVars->find(name);
+				if (it != _state->localVars->end())
+					return it->_value;
 			}
 			if (_state->me.type == OBJECT && _state->me.u.obj->hasProp(name)) {
 				return _state->me.u.obj->getProp(name);
 			}
-			if (_globalvars.contains(name)) {
-				return _globalvars[name];
+			DatumHash::iterator it = _globalvars.find(name);
+			if (it != _globalvars.end()) {
+				return it->_value;
 			}
 
 			if (!silent)
@@ -1876,10 +1922,10 @@ Datum Lingo::varFetch(const Datum &var, bool silent) {
 		break;
 	case GLOBALREF:
 		{
-			Common::String name = *var.u.s;
 			g_debugger->varReadHook(name);
-			if (_globalvars.contains(name)) {
-				return _globalvars[name];
+			DatumHash::iterator it = _globalvars.find(name);
+			if (it != _globalvars.end()) {
+				return it->_value;
 			}
 			debugC(1, kDebugLingoExec, "varFetch: global variable %s not defined", name.c_str());
 			return result;
@@ -1887,10 +1933,11 @@ Datum Lingo::varFetch(const Datum &var, bool silent) {
 		break;
 	case LOCALREF:
 		{
-			Common::String name = *var.u.s;
 			g_debugger->varReadHook(name);
-			if (_state->localVars && _state->localVars->contains(name)) {
-				return (*_state->localVars)[name];
+			if (_state->localVars) {
+				DatumHash::iterator it = _state->localVars->find(name);
+				if (it != _state->localVars->end())
+					return it->_value;
 			}
 			debugC(1, kDebugLingoExec, "varFetch: local variable %s not defined", name.c_str());
 			return result;
@@ -1898,7 +1945,6 @@ Datum Lingo::varFetch(const Datum &var, bool silent) {
 		break;
 	case PROPREF:
 		{
-			Common::String name = *var.u.s;
 			g_debugger->varReadHook(name);
 			if (_state->me.type == OBJECT && _state->me.u.obj->hasProp(name)) {
 				return _state->me.u.obj->getProp(name);
@@ -1907,6 +1953,23 @@ Datum Lingo::varFetch(const Datum &var, bool silent) {
 			return result;
 		}
 		break;
+	default:
+		warning("varFetch: fetch from non-variable");
+		break;
+	}
+
+	return result;
+}
+
+Datum Lingo::varFetch(const Datum &var, bool silent) {
+	Datum result;
+
+	switch (var.type) {
+	case VARREF:
+	case GLOBALREF:
+	case LOCALREF:
+	case PROPREF:
+		return fetchVariable(var.type, *var.u.s, silent);
 	case FIELDREF:
 	case CASTREF:
 	case CHUNKREF:
@@ -144,7 +144,9 @@ struct Datum {	/* interpreter stack type */
 		PictureReference *picture; /* PICTUREREF */
 	} u;
 
-	int *refCount;
+	// Shared between copies of the Datum. Plain values (void, integers, floats)
+	// don't allocate it until a pointer is stored in them.
+	mutable int *refCount;
 
 	bool ignoreGlobal; // True if this Datum should be ignored by showGlobals and clearGlobals
 
@@ -190,6 +192,10 @@ struct Datum {	/* interpreter stack type */
 	bool operator<(const Datum &d) const;
 	bool operator>=(const Datum &d) const;
 	bool operator<=(const Datum &d) const;
+
+private:
+	bool hasInlineValue() const;
+	void ensureRefCount() const;
 };
 
 struct ChunkReference {
@@ -435,6 +441,10 @@ public:
 	void cleanLocalVars();
 	void varAssign(const Datum &var, const Datum &value);
 	Datum varFetch(const Datum &var, bool silent = false);
+	// Variable access by name for VARREF, GLOBALREF, LOCALREF and PROPREF,
+	// without allocating a reference Datum
+	void assignVariable(DatumType refType, const Common::String &name, const Datum &value);
+	Datum fetchVariable(DatumType refType, const Common::String &name, bool silent = false);
 	Common::U32String evalChunkRef(const Datum &var);
 	Datum findVarV4(int varType, const Datum &id);
 	CastMemberID resolveCastMember(const Datum &memberID, const Datum &castLib, CastType type);
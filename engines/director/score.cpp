@@ -47,6 +47,7 @@
 #include "director/sprite.h"
 #include "director/window.h"
 #include "director/castmember/castmember.h"
+#include "director/castmember/bitmap.h"
 #include "director/castmember/filmloop.h"
 #include "director/castmember/movie.h"
 #include "director/castmember/transition.h"
@@ -120,6 +121,8 @@ Score::~Score() {
 	if (_currentFrame) {
 		delete _currentFrame;
 	}
+
+	delete _lookAheadFrame;
 }
 
 void Score::setPuppetTempo(int16 puppetTempo) {
@@ -516,6 +519,9 @@ void Score::updateCurrentFrame() {
 		// Finally, update the channels and buffer any dirty rectangles.
 		// This will ignore any channel data that is overridden with the puppet flag.
 		updateSprites(kRenderModeNormal, true);
+
+		trimCastCache();
+		queueCastLookAhead();
 	} else if (!_window->_playbackPaused) {
 		// Loading the same frame; e.g. "go to frame".
 		// This is mostly a no-op, however any sprite changes for
@@ -660,6 +666,8 @@ void Score::update() {
 			if (!hasJump) {
 				processFrozenScripts();
 			}
+
+			preloadNextCastMember();
 			return;
 		}
 	}
@@ -688,6 +696,7 @@ void Score::update() {
 			processFrozenScripts();
 		}
 
+		preloadNextCastMember();
 		return;
 	}
 	_nextFrameDelay = 0;
@@ -2302,6 +2311,222 @@ bool Score::readOneFrame() {
 	return false; // Error in loading frame
 }
 
+void Score::queueCastLookAhead() {
+	_castLookAhead.clear();
+	if (!_framesStream)
+		return;
+
+	const uint32 kCastLookAheadFrames = 10;
+
+	// The window read so far stays valid while playing on, as the frame data
+	// is the same however the current frame was reached. After a jump
+	// elsewhere, it restarts from a copy of the current frame.
+	bool valid = _lookAheadFrame && _curFrameNumber <= _lookAheadEnd &&
+		(_lookAheadWindow.empty() || _lookAheadWindow[0].frameNum <= _curFrameNumber + 1);
+	if (!valid) {
+		delete _lookAheadFrame;
+		_lookAheadFrame = new Frame(*_currentFrame);
+		_lookAheadEnd = _curFrameNumber;
+		_lookAheadPos = _framesStream->pos();
+		_lookAheadAtEnd = false;
+		_lookAheadWindow.clear();
+	}
+
+	while (!_lookAheadWindow.empty() && _lookAheadWindow[0].frameNum <= _curFrameNumber)
+		_lookAheadWindow.remove_at(0);
+
+	if (!_lookAheadAtEnd && _lookAheadEnd < _curFrameNumber + kCastLookAheadFrames) {
+		// Read the frames past the window on the scratch frame, the frame
+		// data is stored as deltas from the previous frame
+		int64 pos = _framesStream->pos();
+		uint32 curFrameNumber = _curFrameNumber;
+		Frame *currentFrame = _currentFrame;
+		_currentFrame = _lookAheadFrame;
+		_framesStream->seek(_lookAheadPos);
+
+		while (_lookAheadEnd < curFrameNumber + kCastLookAheadFrames) {
+			_curFrameNumber = _lookAheadEnd + 1;
+			if (!readOneFrame()) {
+				_lookAheadAtEnd = true;
+				break;
+			}
+			_lookAheadEnd++;
+
+			LookAheadFrame frame;
+			frame.frameNum = _lookAheadEnd;
+			for (uint j = 0; j < _currentFrame->_sprites.size(); j++) {
+				CastMemberID castId = _currentFrame->_sprites[j]->_castId;
+				if (castId.member && Common::find(frame.members.begin(), frame.members.end(), castId) == frame.members.end())
+					frame.members.push_back(castId);
+			}
+
+			const MainChannels &mainChannels = _currentFrame->_mainChannels;
+			CastMemberID others[] = { mainChannels.sound1, mainChannels.sound2, mainChannels.palette.paletteId };
+			for (uint j = 0; j < ARRAYSIZE(others); j++) {
+				if (others[j].member > 0 && Common::find(frame.members.begin(), frame.members.end(), others[j]) == frame.members.end())
+					frame.members.push_back(others[j]);
+			}
+
+			_lookAheadWindow.push_back(frame);
+		}
+
+		_lookAheadPos = _framesStream->pos();
+		_currentFrame = currentFrame;
+		_curFrameNumber = curFrameNumber;
+		_framesStream->seek(pos);
+	}
+
+	// The nearest frames are decoded first, so they go to the back
+	for (int i = _lookAheadWindow.size() - 1; i >= 0; i--) {
+		const Common::Array<CastMemberID> &members = _lookAheadWindow[i].members;
+		for (uint j = 0; j < members.size(); j++) {
+			if (Common::find(_castLookAhead.begin(), _castLookAhead.end(), members[j]) == _castLookAhead.end())
+				_castLookAhead.push_back(members[j]);
+		}
+	}
+}
+
+bool Score::preloadNextCastMember() {
+	while (!_castLookAhead.empty()) {
+		CastMemberID castId = _castLookAhead.back();
+		_castLookAhead.pop_back();
+
+		// Look the member up without loading it to check its type
+		Cast *cast = _movie->getCast(castId);
+		if (!cast || !cast->_loadedCast || !cast->_loadedCast->contains(castId.member))
+			continue;
+
+		CastMember *member = cast->_loadedCast->getVal(castId.member);
+		if (member->isLoaded() && !member->needsReload())
+			continue;
+
+		switch (member->_type) {
+		case kCastBitmap:
+		case kCastText:
+		case kCastSound:
+		case kCastPalette:
+			break;
+		default:
+			continue;
+		}
+
+		debugC(5, kDebugLoading, "Score::preloadNextCastMember(): decoding %s ahead of frame %d", castId.asString().c_str(), _curFrameNumber);
+		_movie->getCastMember(castId);
+		_vm->_castPreloads++;
+		return true;
+	}
+
+	return false;
+}
+
+uint32 Score::getDecodedCastSize(Common::Array<BitmapCastMember *> *bitmaps) {
+	Common::Array<Cast *> casts;
+	for (auto &it : *_movie->getCasts())
+		casts.push_back(it._value);
+	if (_movie->getSharedCast())
+		casts.push_back(_movie->getSharedCast());
+
+	uint32 total = 0;
+	for (uint i = 0; i < casts.size(); i++) {
+		if (!casts[i] || !casts[i]->_loadedCast)
+			continue;
+
+		for (auto &it : *casts[i]->_loadedCast) {
+			if (it._value->_type != kCastBitmap)
+				continue;
+
+			BitmapCastMember *bitmap = (BitmapCastMember *)it._value;
+			uint32 size = bitmap->getDecodedSize();
+			if (!size)
+				continue;
+
+			total += size;
+			if (bitmaps)
+				bitmaps->push_back(bitmap);
+		}
+	}
+
+	return total;
+}
+
+void Score::trimCastCache() {
+	if (!_vm->_castCacheBudget)
+		return;
+
+	uint32 now = _vm->getMacTicks();
+	for (uint i = 0; i < _channels.size(); i++) {
+		if (_channels[i]->_sprite && _channels[i]->_sprite->_cast)
+			markCastOnStage(_channels[i]->_sprite->_cast, now);
+	}
+
+	// The members of the look-ahead window are about to go on stage, so
+	// those decoded ahead are kept for them
+	for (uint i = 0; i < _lookAheadWindow.size(); i++) {
+		const Common::Array<CastMemberID> &members = _lookAheadWindow[i].members;
+		for (uint j = 0; j < members.size(); j++) {
+			// Look the member up without loading it
+			Cast *cast = _movie->getCast(members[j]);
+			if (cast && cast->_loadedCast && cast->_loadedCast->contains(members[j].member))
+				markCastOnStage(cast->_loadedCast->getVal(members[j].member), now);
+		}
+	}
+
+	Common::Array<BitmapCastMember *> decoded;
+	uint32 total = getDecodedCastSize(&decoded);
+
+	// Members on stage keep their decoded image, their widgets refer to it,
+	// and so do the upcoming ones
+	Common::Array<BitmapCastMember *> bitmaps;
+	for (uint i = 0; i < decoded.size(); i++) {
+		if (decoded[i]->_lastOnStage != now)
+			bitmaps.push_back(decoded[i]);
+	}
+
+	while (total > _vm->_castCacheBudget && !bitmaps.empty()) {
+		uint oldest = 0;
+		for (uint i = 1; i < bitmaps.size(); i++) {
+			if (bitmaps[i]->_lastOnStage < bitmaps[oldest]->_lastOnStage)
+				oldest = i;
+		}
+
+		total -= bitmaps[oldest]->getDecodedSize();
+		bitmaps[oldest]->unload();
+		bitmaps.remove_at(oldest);
+		_vm->_castEvictions++;
+	}
+}
+
+void Score::markCastOnStage(CastMember *member, uint32 now) {
+	if (member->_lastOnStage == now)
+		return;
+	member->_lastOnStage = now;
+
+	if (member->_type != kCastFilmLoop)
+		return;
+
+	// A film loop shows the members of all its frames in turn
+	Score *score = ((FilmLoopCastMember *)member)->_score;
+	if (!score)
+		return;
+
+	for (auto &frame : score->_scoreCache) {
+		for (auto &sprite : frame->_sprites) {
+			if (!sprite || !sprite->_castId.member)
+				continue;
+
+			CastMember *subMember = sprite->_cast;
+			if (!subMember) {
+				// Look the member up without loading it
+				Cast *cast = _movie->getCast(sprite->_castId);
+				if (!cast || !cast->_loadedCast || !cast->_loadedCast->contains(sprite->_castId.member))
+					continue;
+				subMember = cast->_loadedCast->getVal(sprite->_castId.member);
+			}
+			markCastOnStage(subMember, now);
+		}
+	}
+}
+
 Frame *Score::getFrameData(int frameNum){
 	// This function is for previewing selected frame,
 	// It doesn't make any changes to current render state
@@ -52,6 +52,7 @@ class Cursor;
 class Channel;
 class Sprite;
 class CastMember;
+class BitmapCastMember;
 class AudioDecoder;
 struct BehaviorElement;
 struct SpriteInfo;
@@ -98,6 +99,7 @@ public:
 
 	void setCurrentFrame(uint16 frameId);
 	uint16 getCurrentFrameNum() { return _curFrameNumber; }
+	uint32 getDecodedCastSize(Common::Array<BitmapCastMember *> *bitmaps = nullptr);
 	int getNextFrame() { return _nextFrame; }
 	uint16 getFramesNum() { return _numFrames; }
 
@@ -170,6 +172,11 @@ private:
 
 	void loadFrameSpriteDetails(bool skipLog);
 
+	void queueCastLookAhead();
+	bool preloadNextCastMember();
+	void trimCastCache();
+	void markCastOnStage(CastMember *member, uint32 now);
+
 	BehaviorElement loadSpriteBehavior(Common::MemoryReadStreamEndian *stream, bool skipLog);
 	SpriteInfo loadSpriteInfo(int spriteId, bool skipLog);
 
@@ -259,6 +266,22 @@ private:
 
 	int _previousBuildBotBuild = -1;
 	bool _firstRun = true;
+
+	// Cast members used by the upcoming frames, decoded while waiting
+	Common::Array<CastMemberID> _castLookAhead;
+
+	// Frames already read ahead, kept while playing on so that each frame
+	// advance only reads one more. _lookAheadFrame holds the channel state
+	// after frame _lookAheadEnd, which ends at stream offset _lookAheadPos.
+	struct LookAheadFrame {
+		uint32 frameNum;
+		Common::Array<CastMemberID> members;
+	};
+	Common::Array<LookAheadFrame> _lookAheadWindow;
+	Frame *_lookAheadFrame = nullptr;
+	uint32 _lookAheadEnd = 0;
+	int64 _lookAheadPos = 0;
+	bool _lookAheadAtEnd = false;
 };
 
 } // End of namespace Director
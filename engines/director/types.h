@@ -467,6 +467,7 @@ enum CompareResult {
 enum DebugDrawModes {
 	kDebugDrawCast  = 1 << 0,
 	kDebugDrawFrame = 1 << 1,
+	kDebugDrawDirty = 1 << 2,
 };
 
 struct Datum;
@@ -197,7 +197,7 @@ void Window::renderChannel(Channel *channel, const Common::Rect &rect, Graphics:
 	}
 
 	size_t startIdx = 0;
-	if (channel->isTrail()) {
+	if (channel && channel->isTrail()) {
 		// trails mode, don't redraw anything stationary below the target
 		for (size_t i = 0; i < dirtyChannels.size(); i++) {
 			if (dirtyChannels[i] == channel) {
@@ -221,7 +221,7 @@ void Window::renderChannel(Channel *channel, const Common::Rect &rect, Graphics:
 				}
 			} else {
 				inkBlitFrom(ch, r, blitTo);
-				if ((ch == channel) && invert)
+				if (channel && (ch == channel) && invert)
 					invertChannel(ch, r);
 			}
 		}
@@ -270,6 +270,19 @@ bool Window::render(bool forceRedraw, Graphics::ManagedSurface *blitTo) {
 	debugC(7, kDebugImages, "Window::render(): starting draw cycle for frame %d", score->getCurrentFrameNum());
 	uint32 renderStartTime = g_system->getMillis();
 
+	// Erase the outlines of the previous debug overlay
+	if (!_debugDirtyRects.empty()) {
+		renderRects(_debugDirtyRects, nullptr, blitTo);
+		_debugDirtyRects.clear();
+	}
+
+	// The areas changed by regular channels are collected without overlaps
+	// and recomposed once, instead of redrawing everything below each of them.
+	// Trails keep what is under them, so they are drawn in channel order.
+	Common::Array<Common::Rect> pendingRects;
+	Common::Array<Common::Rect> renderedRects;
+	Channel *pendingHilite = nullptr;
+
 	for (size_t i = 0; i < score->_channels.size(); i++) {
 		Channel *chan = score->_channels[i];
 		if (!chan->_needsDraw && !forceRedraw)
@@ -278,15 +291,32 @@ bool Window::render(bool forceRedraw, Graphics::ManagedSurface *blitTo) {
 
 		debugC(7, kDebugImages, "Window::render(): drawing channel %d", (int)i);
 
-		if (!chan->_lastTrail) {
-			renderChannel(chan, chan->_lastRenderedBbox, blitTo, chan == hiliteChannel);
+		if (chan->isTrail() || chan->_lastTrail) {
+			renderRects(pendingRects, pendingHilite, blitTo);
+			renderedRects.push_back(pendingRects);
+			pendingRects.clear();
+			pendingHilite = nullptr;
+
+			if (!chan->_lastTrail) {
+				renderChannel(chan, chan->_lastRenderedBbox, blitTo, chan == hiliteChannel);
+				renderedRects.push_back(chan->_lastRenderedBbox);
+			}
+			renderChannel(chan, bbox, blitTo, chan == hiliteChannel);
+			renderedRects.push_back(bbox);
+		} else {
+			addRenderRect(pendingRects, chan->_lastRenderedBbox);
+			addRenderRect(pendingRects, bbox);
+			if (chan == hiliteChannel)
+				pendingHilite = chan;
 		}
-		renderChannel(chan, bbox, blitTo, chan == hiliteChannel);
 		chan->_needsDraw = false;
 		chan->_lastRenderedBbox = bbox;
 		chan->_lastTrail = chan->isTrail();
 	}
 
+	renderRects(pendingRects, pendingHilite, blitTo);
+	renderedRects.push_back(pendingRects);
+
 	Common::List<Common::Rect> &dirtyRects = _window->getDirtyRectList();
 
 	if (forceRedraw) {
@@ -328,7 +358,11 @@ bool Window::render(bool forceRedraw, Graphics::ManagedSurface *blitTo) {
 	if (g_director->_debugDraw & kDebugDrawFrame)
 		drawFrameCounter(blitTo);
 
-	debugC(7, kDebugImages, "Window::render(): Draw cycle finished in %d ms, %d dirty rects",  g_system->getMillis() - renderStartTime, dirtyRects.size());
+	uint32 renderTime = g_system->getMillis() - renderStartTime;
+	if (g_director->_debugDraw & kDebugDrawDirty)
+		drawDirtyRects(renderedRects, renderTime, blitTo);
+
+	debugC(7, kDebugImages, "Window::render(): Draw cycle finished in %d ms, %d dirty rects, %d areas recomposed",  renderTime, dirtyRects.size(), renderedRects.size());
 
 	dirtyRects.clear();
 	_window->setContentDirty(true);
@@ -336,6 +370,71 @@ bool Window::render(bool forceRedraw, Graphics::ManagedSurface *blitTo) {
 	return true;
 }
 
+void Window::addRenderRect(Common::Array<Common::Rect> &rects, const Common::Rect &rect) {
+	if (rect.isEmpty())
+		return;
+
+	// Only keep the parts of the rect not already covered
+	Common::Array<Common::Rect> pieces;
+	pieces.push_back(rect);
+
+	for (uint i = 0; i < rects.size() && !pieces.empty(); i++) {
+		const Common::Rect &cut = rects[i];
+		Common::Array<Common::Rect> remaining;
+
+		for (uint j = 0; j < pieces.size(); j++) {
+			const Common::Rect &piece = pieces[j];
+			if (!cut.intersects(piece)) {
+				remaining.push_back(piece);
+				continue;
+			}
+
+			int16 top = MAX(piece.top, cut.top);
+			int16 bottom = MIN(piece.bottom, cut.bottom);
+			if (piece.top < cut.top)
+				remaining.push_back(Common::Rect(piece.left, piece.top, piece.right, cut.top));
+			if (cut.bottom < piece.bottom)
+				remaining.push_back(Common::Rect(piece.left, cut.bottom, piece.right, piece.bottom));
+			if (piece.left < cut.left)
+				remaining.push_back(Common::Rect(piece.left, top, cut.left, bottom));
+			if (cut.right < piece.right)
+				remaining.push_back(Common::Rect(cut.right, top, piece.right, bottom));
+		}
+
+		pieces = remaining;
+	}
+
+	rects.push_back(pieces);
+}
+
+void Window::renderRects(const Common::Array<Common::Rect> &rects, Channel *hiliteChannel, Graphics::ManagedSurface *blitTo) {
+	for (uint i = 0; i < rects.size(); i++)
+		renderChannel(hiliteChannel, rects[i], blitTo, hiliteChannel != nullptr);
+}
+
+void Window::drawDirtyRects(const Common::Array<Common::Rect> &rects, uint32 renderTime, Graphics::ManagedSurface *blitTo) {
+	uint32 area = 0;
+	for (uint i = 0; i < rects.size(); i++) {
+		Common::Rect r = rects[i];
+		r.clip(blitTo->getBounds());
+		if (r.isEmpty())
+			continue;
+
+		area += r.width() * r.height();
+		blitTo->frameRect(r, _wm->_colorWhite);
+		_debugDirtyRects.push_back(r);
+	}
+
+	const Graphics::Font *font = FontMan.getFontByUsage(Graphics::FontManager::kConsoleFont);
+	Common::String msg = Common::String::format("%d areas, %d px, %d ms", rects.size(), area, renderTime);
+	uint32 width = font->getStringWidth(msg);
+	Common::Rect textRect(1, blitTo->h - font->getFontHeight() - 3, width + 4, blitTo->h - 1);
+
+	blitTo->fillRect(textRect, _wm->_colorBlack);
+	font->drawString(blitTo, msg, 3, textRect.top + 2, width, _wm->_colorWhite);
+	_debugDirtyRects.push_back(textRect);
+}
+
 void Window::setStageColor(uint32 stageColor, bool forceReset) {
 	if (stageColor != _stageColor || forceReset) {
 		_stageColor = stageColor;
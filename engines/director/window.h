@@ -261,9 +261,16 @@ private:
 	Common::String _sharedCastFilenameHint;
 	Common::String _soundsFilenameHint;
 
+	// Rects outlined by the "draw dirty" debug overlay on the last render
+	Common::Array<Common::Rect> _debugDirtyRects;
+
 private:
 	static void drawChannelBox(Director::Movie *currentMovie, Graphics::ManagedSurface *blitTo, int selectedChannel);
 	void drawFrameCounter(Graphics::ManagedSurface *blitTo);
+	void drawDirtyRects(const Common::Array<Common::Rect> &rects, uint32 renderTime, Graphics::ManagedSurface *blitTo);
+
+	static void addRenderRect(Common::Array<Common::Rect> &rects, const Common::Rect &rect);
+	void renderRects(const Common::Array<Common::Rect> &rects, Channel *hiliteChannel, Graphics::ManagedSurface *blitTo);
 
 
 };
@@ -152,6 +152,7 @@ Engine::Engine(OSystem *syst)
 		_pauseScreenChangeID(-1),
 		_saveSlotToLoad(-1),
 		_autoSaving(false),
+		_pendingSave(nullptr),
 		_engineStartTime(_system->getMillis()),
 		_mainMenuDialog(NULL),
 		_debugger(NULL),
@@ -216,6 +217,8 @@ Engine::Engine(OSystem *syst)
 }
 
 Engine::~Engine() {
+	flushPendingSave();
+
 	_mixer->stopAll();
 
 	// Flush any pending remaining events
@@ -625,6 +628,9 @@ void Engine::warnMissingExtractedCDAudio() {
 }
 
 void Engine::handleAutoSave() {
+	if (_pendingSave)
+		processPendingSave(false);
+
 #ifdef ENABLE_EVENTRECORDER
 	if (!g_eventRec.processAutosave())
 		return;
@@ -682,6 +688,9 @@ void Engine::saveAutosaveIfEnabled() {
 		return;
 	_autoSaving = true;
 
+	// The slot check below needs the previous autosave to be complete
+	flushPendingSave();
+
 	bool saveFlag = canSaveAutosaveCurrently();
 	const Common::String autoSaveName = Common::convertFromU32String(_("Autosave"));
 
@@ -815,6 +824,9 @@ void Engine::drawHotspots() {
 }
 
 void Engine::openMainMenuDialog() {
+	// The dialogs may list the saves, so make sure they are complete
+	flushPendingSave();
+
 	if (!_mainMenuDialog)
 		_mainMenuDialog = new MainMenuDialog(this);
 	Common::TextToSpeechManager *ttsMan = g_system->getTextToSpeechManager();
@@ -839,6 +851,8 @@ void Engine::openMainMenuDialog() {
 	// mouse cursor glitches and similar bugs,
 	// e.g. #4420).
 	if (_saveSlotToLoad >= 0) {
+		// Engines may load the slot with their own code
+		flushPendingSave();
 		Common::Error status = loadGameState(_saveSlotToLoad);
 		if (status.getCode() != Common::kNoError) {
 			Common::U32String failMessage = Common::U32String::format(_("Failed to load saved game (%s)! "
@@ -1037,6 +1051,7 @@ void Engine::flipMute() {
 Common::Error Engine::loadGameState(int slot) {
 	// In case autosaves are on, do a save first before loading the new save
 	saveAutosaveIfEnabled();
+	flushPendingSave();
 
 	Common::InSaveFile *saveFile = _saveFileMan->openForLoading(getSaveStateName(slot));
 
@@ -1065,6 +1080,22 @@ bool Engine::canLoadGameStateCurrently(Common::U32String *msg) {
 }
 
 Common::Error Engine::saveGameState(int slot, const Common::String &desc, bool isAutosave) {
+	flushPendingSave();
+
+	if (isAutosave) {
+		// Only serialize the game here, compression and writing to disk are
+		// done while the game keeps running
+		Common::MemoryWriteStreamDynamic saveData(DisposeAfterUse::NO);
+		Common::Error result = saveGameStream(&saveData, isAutosave);
+		if (result.getCode() == Common::kNoError) {
+			getMetaEngine()->appendExtendedSaveToStream(&saveData, getTotalPlayTime(), desc, isAutosave);
+			deferSaveFile(getSaveStateName(slot), saveData.getData(), saveData.size(), isAutosave);
+		} else {
+			free(saveData.getData());
+		}
+		return result;
+	}
+
 	Common::OutSaveFile *saveFile = _saveFileMan->openForSaving(getSaveStateName(slot));
 
 	if (!saveFile)
@@ -1086,12 +1117,85 @@ Common::Error Engine::saveGameStream(Common::WriteStream *stream, bool isAutosav
 	return Common::kWritingFailed;
 }
 
+struct PendingSave {
+	Common::String filename;
+	byte *data;
+	uint32 size;
+	uint32 written;
+	bool isAutosave;
+	Common::OutSaveFile *file;
+};
+
+/** Amount of save data compressed and written out per event poll. */
+static const uint32 kPendingSaveChunkSize = 32 * 1024;
+
+void Engine::deferSaveFile(const Common::String &filename, byte *data, uint32 size, bool isAutosave) {
+	flushPendingSave();
+
+	_pendingSave = new PendingSave();
+	_pendingSave->filename = filename;
+	_pendingSave->data = data;
+	_pendingSave->size = size;
+	_pendingSave->written = 0;
+	_pendingSave->isAutosave = isAutosave;
+	_pendingSave->file = nullptr;
+}
+
+Common::Error Engine::processPendingSave(bool all) {
+	PendingSave *save = _pendingSave;
+	if (!save)
+		return Common::kNoError;
+
+	Common::Error result = Common::kNoError;
+	if (!save->file) {
+		save->file = _saveFileMan->openForSaving(save->filename);
+		if (!save->file)
+			result = Common::kWritingFailed;
+	}
+
+	if (save->file) {
+		uint32 len = save->size - save->written;
+		if (!all)
+			len = MIN(len, kPendingSaveChunkSize);
+		save->file->write(save->data + save->written, len);
+		save->written += len;
+
+		if (save->written < save->size && !save->file->err())
+			return Common::kNoError;
+
+		save->file->finalize();
+		if (save->file->err())
+			result = Common::kWritingFailed;
+		delete save->file;
+	}
+
+	if (result.getCode() != Common::kNoError) {
+		warning("Failed to write save file '%s'", save->filename.c_str());
+		// Do not leave a truncated save behind
+		if (save->file)
+			_saveFileMan->removeSavefile(save->filename);
+		if (save->isAutosave)
+			g_system->displayMessageOnOSD(_("Error occurred making autosave"));
+	}
+
+	free(save->data);
+	delete save;
+	_pendingSave = nullptr;
+	return result;
+}
+
+Common::Error Engine::flushPendingSave() {
+	return processPendingSave(true);
+}
+
 bool Engine::canSaveGameStateCurrently(Common::U32String *msg) {
 	// Do not allow saving by default
 	return false;
 }
 
 bool Engine::loadGameDialog() {
+	flushPendingSave();
+
 	if (!canLoadGameStateCurrently()) {
 		g_system->displayMessageOnOSD(_("Loading game is currently unavailable"));
 		return false;
@@ -1121,6 +1225,8 @@ bool Engine::loadGameDialog() {
 }
 
 bool Engine::saveGameDialog() {
+	flushPendingSave();
+
 	if (!canSaveGameStateCurrently()) {
 		g_system->displayMessageOnOSD(_("Saving game is currently unavailable"));
 		return false;
@@ -101,6 +101,7 @@ void GUIErrorMessageFormat(MSVC_PRINTF const char *fmt, ...) GCC_PRINTF(1, 2);
 
 
 class Engine;
+struct PendingSave;
 
 /**
 * Class for managing pausing by Engine::pauseEngine that hands out pause tokens.
@@ -261,6 +262,11 @@ private:
 	 */
 	bool _autoSaving;
 
+	/**
+	 * Save file data which has been serialized but not yet written out.
+	 */
+	PendingSave *_pendingSave;
+
 	/**
 	 * Optional debugger for the engine.
 	 */
@@ -508,6 +514,25 @@ public:
 	 */
 	virtual Common::Error saveGameStream(Common::WriteStream *stream, bool isAutosave = false);
 
+	/**
+	 * Return whether a deferred save is still being written out.
+	 *
+	 * Saves are deferred when autosaving through the default saveGameState()
+	 * implementation, or when an engine calls deferSaveFile() itself.
+	 */
+	bool isSavePending() const { return _pendingSave != nullptr; }
+
+	/**
+	 * Finish writing out any deferred save.
+	 *
+	 * Engines which read save files with their own code, rather than through
+	 * loadGameState() or the save/load dialogs, must call this first.
+	 *
+	 * @return The result of writing out the pending save, or kNoError if
+	 *         there was none.
+	 */
+	Common::Error flushPendingSave();
+
 	/**
 	 * Indicate whether a game state can be saved.
 	 *
@@ -731,6 +756,8 @@ public:
 
 	/**
 	 * Check whether it is time to autosave, and if so, do it.
+	 *
+	 * This also writes out the next part of any deferred save.
 	 */
 	void handleAutoSave();
 
@@ -739,6 +766,33 @@ public:
 	 */
 	void saveAutosaveIfEnabled();
 
+protected:
+	/**
+	 * Write out an already serialized save file in the background.
+	 *
+	 * The data is compressed and written out in small parts while the engine
+	 * keeps polling events, so that the game does not freeze while saving.
+	 * Any save still pending is written out first.
+	 *
+	 * @param filename    Name of the save file.
+	 * @param data        Serialized save data. Ownership is transferred, and
+	 *                    it will be freed with free().
+	 * @param size        Size of the data.
+	 * @param isAutosave  Whether errors should be reported as autosave errors.
+	 */
+	void deferSaveFile(const Common::String &filename, byte *data, uint32 size, bool isAutosave);
+
+private:
+	/**
+	 * Write out the next part of the deferred save.
+	 *
+	 * @param all  If true, write out the remaining data at once.
+	 * @return The result of writing out the save if it was completed,
+	 *         kNoError otherwise.
+	 */
+	Common::Error processPendingSave(bool all);
+
+public:
 	/**
 	 * Indicate whether an autosave can currently be done.
 	 */
@@ -0,0 +1,119 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "glk/glulx/debugger.h"
+#include "glk/glulx/glulx.h"
+#include "common/algorithm.h"
+
+namespace Glk {
+namespace Glulx {
+
+struct ProfileLine {
+	uint _addr;
+	uint _count;
+	uint _calls;
+	bool _accel;
+
+	bool operator<(const ProfileLine &rhs) const {
+		return _count > rhs._count || (_count == rhs._count && _calls > rhs._calls);
+	}
+};
+
+Debugger::Debugger() : Glk::Debugger() {
+	registerCmd("profile", WRAP_METHOD(Debugger, cmdProfile));
+}
+
+bool Debugger::cmdProfile(int argc, const char **argv) {
+	Common::String cmd = (argc >= 2) ? argv[1] : "";
+	uint count = (argc >= 3) ? strToInt(argv[2]) : 20;
+
+	if (cmd == "on") {
+		g_vm->prof_set_active(true);
+		debugPrintf("Profiling is on\n");
+	} else if (cmd == "off") {
+		g_vm->prof_set_active(false);
+		debugPrintf("Profiling is off\n");
+	} else if (cmd == "reset") {
+		g_vm->prof_reset();
+		debugPrintf("Profile counts cleared\n");
+	} else if (cmd == "ops") {
+		showOpcodes(count);
+	} else if (cmd == "funcs") {
+		showFunctions(count);
+	} else if (cmd.empty()) {
+		uint hits, misses;
+		g_vm->get_opcache_stats(hits, misses);
+		debugPrintf("Profiling is %s\n", g_vm->prof_is_active() ? "on" : "off");
+		debugPrintf("Operand cache: %u hits, %u misses\n", hits, misses);
+	} else {
+		debugPrintf("Format: profile [on | off | reset | ops [count] | funcs [count]]\n");
+	}
+
+	return true;
+}
+
+void Debugger::showOpcodes(uint count) {
+	Common::Array<ProfileLine> lines;
+	uint total = 0;
+
+	for (uint opcode = 0; opcode <= PROFILE_OPCODES; opcode++) {
+		uint ops = g_vm->prof_get_opcode_count(opcode);
+		if (ops) {
+			ProfileLine line = { opcode, ops, 0, false };
+			lines.push_back(line);
+			total += ops;
+		}
+	}
+
+	Common::sort(lines.begin(), lines.end());
+	debugPrintf("%u opcodes executed\n", total);
+	for (uint idx = 0; idx < lines.size() && idx < count; idx++) {
+		if (lines[idx]._addr == PROFILE_OPCODES)
+			debugPrintf("  >=%03x  %10u\n", PROFILE_OPCODES, lines[idx]._count);
+		else
+			debugPrintf("  %5x  %10u\n", lines[idx]._addr, lines[idx]._count);
+	}
+}
+
+void Debugger::showFunctions(uint count) {
+	// Calls that are still running haven't had their opcodes added in yet
+	Common::HashMap<uint, proffunc_t> funcs = g_vm->prof_get_funcs();
+	const Common::Array<profframe_t> &stack = g_vm->prof_get_stack();
+	for (uint idx = 0; idx < stack.size(); idx++)
+		funcs.getOrCreateVal(stack[idx].addr).ops += stack[idx].ops;
+
+	Common::Array<ProfileLine> lines;
+	for (Common::HashMap<uint, proffunc_t>::const_iterator it = funcs.begin(); it != funcs.end(); ++it) {
+		ProfileLine line = { it->_key, it->_value.ops, it->_value.calls, it->_value.accel };
+		lines.push_back(line);
+	}
+
+	Common::sort(lines.begin(), lines.end());
+	debugPrintf("%u functions called\n", lines.size());
+	debugPrintf("  address       calls    opcodes\n");
+	for (uint idx = 0; idx < lines.size() && idx < count; idx++) {
+		debugPrintf("  %08x  %10u %10u%s\n", lines[idx]._addr, lines[idx]._calls,
+			lines[idx]._count, lines[idx]._accel ? "  (accelerated)" : "");
+	}
+}
+
+} // End of namespace Glulx
+} // End of namespace Glk
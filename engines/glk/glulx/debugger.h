@@ -0,0 +1,53 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef GLK_GLULX_DEBUGGER_H
+#define GLK_GLULX_DEBUGGER_H
+
+#include "glk/debugger.h"
+
+namespace Glk {
+namespace Glulx {
+
+class Debugger : public Glk::Debugger {
+private:
+	/**
+	 * Controls the opcode and function profiler, and shows what it has gathered
+	 */
+	bool cmdProfile(int argc, const char **argv);
+
+	/**
+	 * Lists the most executed opcodes
+	 */
+	void showOpcodes(uint count);
+
+	/**
+	 * Lists the functions that executed the most opcodes
+	 */
+	void showFunctions(uint count);
+public:
+	Debugger();
+};
+
+} // End of namespace Glulx
+} // End of namespace Glk
+
+#endif
@@ -48,44 +48,25 @@ void Glulx::execute_loop() {
 		/* Stash the current opcode's address, in case the interpreter needs to serialize the VM state out-of-band. */
 		prevpc = pc;
 
-		/* Fetch the opcode number. */
-		opcode = Mem1(pc);
-		pc++;
-		if (opcode & 0x80) {
-			/* More than one-byte opcode. */
-			if (opcode & 0x40) {
-				/* Four-byte opcode */
-				opcode &= 0x3F;
-				opcode = (opcode << 8) | Mem1(pc);
-				pc++;
-				opcode = (opcode << 8) | Mem1(pc);
-				pc++;
-				opcode = (opcode << 8) | Mem1(pc);
-				pc++;
-			} else {
-				/* Two-byte opcode */
-				opcode &= 0x7F;
-				opcode = (opcode << 8) | Mem1(pc);
-				pc++;
-			}
-		}
-
-		/* Now we have an opcode number. */
-
-		/* Fetch the structure that describes how the operands for this
-		   opcode are arranged. This is a pointer to an immutable,
-		   static object. */
-		if (opcode < 0x80)
-			oplist = fast_operandlist[opcode];
-		else
-			oplist = lookup_operandlist(opcode);
+		if (pc < ramstart) {
+			/* ROM can never be written to, so its instructions are decoded
+			   once and kept in the operand cache. */
+			const decodedop_t *dop = fetch_decoded_op();
+			opcode = dop->opcode;
+			load_decoded_operands(inst, dop);
+			pc = dop->nextpc;
+		} else {
+			/* Fetch the opcode number, and the structure that describes how
+			   its operands are arranged. */
+			oplist = fetch_opcode(opcode);
 
-		if (!oplist)
-			fatal_error_i("Encountered unknown opcode.", opcode);
+			/* Based on the oplist structure, load the actual operand values
+			   into inst. This moves the PC up to the end of the instruction. */
+			parse_operands(inst, oplist);
+		}
 
-		/* Based on the oplist structure, load the actual operand values
-		   into inst. This moves the PC up to the end of the instruction. */
-		parse_operands(inst, oplist);
+		if (prof_active)
+			prof_opcode(opcode);
 
 		/* Perform the opcode. This switch statement is split in two, based
 		   on some paranoid suspicions about the ability of compilers to
@@ -357,6 +338,8 @@ PerformJump: /* goto label for successful jumping... ironic, no? */
 				value = inst[0].value;
 				stackptr = inst[1].value;
 				pop_callstub(value);
+				if (prof_active)
+					prof_unwind();
 				break;
 
 			case op_copy:
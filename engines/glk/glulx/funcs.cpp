@@ -36,6 +36,8 @@ void Glulx::enter_function(uint funcaddr, uint argc, uint *argv) {
 	accelFunc = accel_get_func(addr);
 	if (accelFunc) {
 		profile_in(addr, stackptr, true);
+		if (prof_active)
+			prof_enter(addr, true);
 		val = (this->*accelFunc)(argc, argv);
 		profile_out(stackptr);
 		pop_callstub(val);
@@ -43,6 +45,8 @@ void Glulx::enter_function(uint funcaddr, uint argc, uint *argv) {
 	}
 
 	profile_in(addr, stackptr, false);
+	if (prof_active)
+		prof_enter(addr, false);
 
 	/* Check the Glulx type identifier byte. */
 	functype = Mem1(addr);
@@ -197,6 +201,8 @@ void Glulx::enter_function(uint funcaddr, uint argc, uint *argv) {
 
 void Glulx::leave_function() {
 	profile_out(stackptr);
+	if (prof_active)
+		prof_leave();
 	stackptr = frameptr;
 }
 
@@ -20,6 +20,7 @@
  */
 
 #include "glk/glulx/glulx.h"
+#include "glk/glulx/debugger.h"
 #include "common/config-manager.h"
 #include "common/translation.h"
 
@@ -34,6 +35,10 @@ Glulx::Glulx(OSystem *syst, const GlkGameDescription &gameDesc) : GlkAPI(syst, g
 		stackptr(0), frameptr(0), pc(0), prevpc(0), origstringtable(0), stringtable(0), valstackbase(0),
 		localsbase(0), endmem(0), protectstart(0), protectend(0),
 		stream_char_handler(nullptr), stream_unichar_handler(nullptr),
+		// operand
+		opcache(nullptr), opcache_hits(0), opcache_misses(0),
+		// profiler
+		prof_active(false),
 		// main
 		library_autorestore_hook(nullptr),
 		// accel
@@ -49,6 +54,11 @@ Glulx::Glulx(OSystem *syst, const GlkGameDescription &gameDesc) : GlkAPI(syst, g
 	g_vm = this;
 
 	glkopInit();
+	prof_reset();
+}
+
+void Glulx::createDebugger() {
+	setDebugger(new Debugger());
 }
 
 void Glulx::runGame() {
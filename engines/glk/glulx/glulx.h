@@ -25,6 +25,8 @@
 #define GLK_GLULXE
 
 #include "common/scummsys.h"
+#include "common/array.h"
+#include "common/hashmap.h"
 #include "common/random.h"
 #include "glk/glk_api.h"
 #include "glk/glulx/glulx_types.h"
@@ -145,6 +147,30 @@ private:
 	 */
 	const operandlist_t *fast_operandlist[0x80];
 
+	/**
+	 * Pre-decoded ROM instructions, indexed by the low bits of their address
+	 */
+	decodedop_t *opcache;
+
+	/**
+	 * Holds a decoded instruction that can't be cached because it runs on into RAM
+	 */
+	decodedop_t opcache_scratch;
+
+	uint opcache_hits, opcache_misses;
+
+	/**@}*/
+
+	/**
+	 * \defgroup profiler fields
+	 * @{
+	 */
+
+	bool prof_active;
+	uint prof_opcodes[PROFILE_OPCODES + 1];     ///< Execution counts by opcode; the last slot is for larger opcodes
+	Common::HashMap<uint, proffunc_t> prof_funcs;
+	Common::Array<profframe_t> prof_stack;
+
 	/**@}*/
 
 	/**
@@ -403,6 +429,11 @@ public:
 	 */
 	void runGame() override;
 
+	/**
+	 * Create the debugger
+	 */
+	void createDebugger() override;
+
 	/**
 	 * Returns the running interpreter type
 	 */
@@ -551,6 +582,37 @@ public:
 	*/
 	void parse_operands(oparg_t *opargs, const operandlist_t *oplist);
 
+	/**
+	 * Read the opcode number at the PC and return its operandlist. Upon return, the PC will be
+	 * at the beginning of the operand mode list.
+	 */
+	const operandlist_t *fetch_opcode(uint &opcode);
+
+	/**
+	 * Return the decoded form of the ROM instruction at the PC, decoding it into the operand
+	 * cache first if it isn't there already. The PC itself is left unchanged.
+	 */
+	const decodedop_t *fetch_decoded_op();
+
+	/**
+	 * Load the operand values of a decoded instruction into args, in the same way parse_operands()
+	 * would. This doesn't move the PC.
+	 */
+	void load_decoded_operands(oparg_t *opargs, const decodedop_t *dop);
+
+	/**
+	 * Free the operand cache
+	 */
+	void final_operands();
+
+	/**
+	 * Returns how many instructions were found in, or had to be added to, the operand cache
+	 */
+	void get_opcache_stats(uint &hits, uint &misses) const {
+		hits = opcache_hits;
+		misses = opcache_misses;
+	}
+
 	/**
 	 * Store a result value, according to the desttype and destaddress given. This is usually used to store
 	 * the result of an opcode, but it's also used by any code that pulls a call-stub off the stack.
@@ -836,6 +898,54 @@ public:
 	void profile_quit() {}
 #endif /* VM_PROFILING */
 
+	/**
+	 * Start or stop gathering opcode and function counts. These are kept separately from the
+	 * VM_PROFILING hooks, so they are available in every build.
+	 */
+	void prof_set_active(bool active);
+	bool prof_is_active() const { return prof_active; }
+
+	/**
+	 * Clear the gathered counts
+	 */
+	void prof_reset();
+
+	/**
+	 * Record entry into a function. Accelerated functions run no opcodes, so only their calls
+	 * are counted.
+	 */
+	void prof_enter(uint addr, bool accel);
+
+	/**
+	 * Record a return from the function whose frame is at frameptr
+	 */
+	void prof_leave();
+
+	/**
+	 * Drop any tracked calls whose frames are gone, after a throw has unwound the stack
+	 */
+	void prof_unwind();
+
+	/**
+	 * Count an executed opcode
+	 */
+	void prof_opcode(uint opcode) {
+		prof_opcodes[MIN<uint>(opcode, PROFILE_OPCODES)]++;
+		if (!prof_stack.empty())
+			prof_stack.back().ops++;
+	}
+
+	/**
+	 * Returns how many times an opcode was executed. Pass PROFILE_OPCODES for the total of
+	 * all opcodes beyond the table.
+	 */
+	uint prof_get_opcode_count(uint opcode) const {
+		return prof_opcodes[MIN<uint>(opcode, PROFILE_OPCODES)];
+	}
+
+	const Common::HashMap<uint, proffunc_t> &prof_get_funcs() const { return prof_funcs; }
+	const Common::Array<profframe_t> &prof_get_stack() const { return prof_stack; }
+
 #ifdef VM_DEBUGGER
 	unsigned long debugger_opcount;
 	void debugger_tick() { debugger_opcount++ }
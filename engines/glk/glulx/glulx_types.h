@@ -351,6 +351,66 @@ typedef oparg_struct oparg_t;
 
 #define MAX_OPERANDS (8)
 
+/**
+ * How a pre-decoded operand gets its value when the instruction runs.
+ */
+enum decodedkind {
+	decoded_Const = 0,  ///< The value is a constant
+	decoded_Pop = 1,    ///< Pop the value off the stack
+	decoded_Mem = 2,    ///< Read the value from main memory
+	decoded_Locals = 3, ///< Read the value from the locals segment
+	decoded_Store = 4   ///< A store operand; desttype and value are fixed
+};
+
+/**
+ * One operand of an instruction in the operand cache. Constants, addresses and store destinations
+ * are worked out when the entry is filled, so only stack and memory reads are left to do.
+ */
+struct decodedarg_struct {
+	uint kind;          ///< One of the decodedkind values
+	uint desttype;      ///< Destination type for store operands
+	uint value;         ///< Constant value, memory address, locals offset or store address
+};
+typedef decodedarg_struct decodedarg_t;
+
+/**
+ * An instruction whose opcode and operand modes have already been parsed. Only instructions
+ * that lie entirely in ROM are cached, since ROM can never be written to.
+ */
+struct decodedop_struct {
+	uint addr;                      ///< Address of the instruction, or 0 for an empty entry
+	uint opcode;
+	uint nextpc;                    ///< Address of the following instruction
+	const operandlist_t *oplist;
+	decodedarg_t args[MAX_OPERANDS];
+};
+typedef decodedop_struct decodedop_t;
+
+#define OPCACHE_SIZE (4096)
+
+/**
+ * Call and execution counts gathered by the profiler for one function.
+ */
+struct proffunc_struct {
+	uint calls;         ///< Number of times the function was entered
+	uint ops;           ///< Opcodes executed in the function itself, excluding its callees
+	bool accel;         ///< Whether the calls went to an accelerated function
+};
+typedef proffunc_struct proffunc_t;
+
+/**
+ * A function call the profiler is tracking. The stack use is where the call's frame starts,
+ * which is what frameptr holds while the function is running.
+ */
+struct profframe_struct {
+	uint addr;
+	uint stackuse;
+	uint ops;
+};
+typedef profframe_struct profframe_t;
+
+#define PROFILE_OPCODES (0x200)
+
 typedef uint(Glulx::*acceleration_func)(uint argc, uint *argv);
 
 struct accelentry_struct {
@@ -66,6 +66,24 @@ static const operandlist_t list_LLSS = { 4, 4, &array_LLSS[0] };
 void Glulx::init_operands() {
 	for (int ix = 0; ix < 0x80; ix++)
 		fast_operandlist[ix] = lookup_operandlist(ix);
+
+	/* The cache is only valid for one game file, so it starts out empty.
+	   No instruction lives at address zero, which marks a free entry. */
+	if (!opcache) {
+		opcache = (decodedop_t *)glulx_malloc(OPCACHE_SIZE * sizeof(decodedop_t));
+		if (!opcache)
+			fatal_error("Unable to allocate operand cache.");
+	}
+	for (int ix = 0; ix < OPCACHE_SIZE; ix++)
+		opcache[ix].addr = 0;
+	opcache_hits = opcache_misses = 0;
+}
+
+void Glulx::final_operands() {
+	if (opcache) {
+		glulx_free(opcache);
+		opcache = nullptr;
+	}
 }
 
 const operandlist_t *Glulx::lookup_operandlist(uint opcode) {
@@ -516,6 +534,239 @@ WrLocalsAddr:
 	}
 }
 
+const operandlist_t *Glulx::fetch_opcode(uint &opcode) {
+	const operandlist_t *oplist;
+
+	opcode = Mem1(pc);
+	pc++;
+	if (opcode & 0x80) {
+		/* More than one-byte opcode. */
+		if (opcode & 0x40) {
+			/* Four-byte opcode */
+			opcode &= 0x3F;
+			opcode = (opcode << 8) | Mem1(pc);
+			pc++;
+			opcode = (opcode << 8) | Mem1(pc);
+			pc++;
+			opcode = (opcode << 8) | Mem1(pc);
+			pc++;
+		} else {
+			/* Two-byte opcode */
+			opcode &= 0x7F;
+			opcode = (opcode << 8) | Mem1(pc);
+			pc++;
+		}
+	}
+
+	/* Fetch the structure that describes how the operands for this
+	   opcode are arranged. This is a pointer to an immutable,
+	   static object. */
+	if (opcode < 0x80)
+		oplist = fast_operandlist[opcode];
+	else
+		oplist = lookup_operandlist(opcode);
+
+	if (!oplist)
+		fatal_error_i("Encountered unknown opcode.", opcode);
+
+	return oplist;
+}
+
+const decodedop_t *Glulx::fetch_decoded_op() {
+	decodedop_t *dop = &opcache[pc & (OPCACHE_SIZE - 1)];
+	if (dop->addr == pc) {
+		opcache_hits++;
+		return dop;
+	}
+
+	opcache_misses++;
+
+	/* Decode into the scratch entry first, so that a fatal error part way
+	   through never leaves a half-filled entry in the cache. */
+	decodedop_t *dest = &opcache_scratch;
+	uint startpc = pc;
+	dest->oplist = fetch_opcode(dest->opcode);
+
+	int numops = dest->oplist->num_ops;
+	uint modeaddr = pc;
+	int modeval = 0;
+
+	pc += (numops + 1) / 2;
+
+	for (int ix = 0; ix < numops; ix++) {
+		decodedarg_t *darg = &dest->args[ix];
+		int mode;
+		uint value = 0;
+
+		if ((ix & 1) == 0) {
+			modeval = Mem1(modeaddr);
+			mode = (modeval & 0x0F);
+		} else {
+			mode = ((modeval >> 4) & 0x0F);
+			modeaddr++;
+		}
+
+		/* Read the operand bytes that follow the mode list. */
+		switch (mode) {
+		case 1:
+			value = (int)(signed char)(Mem1(pc));
+			pc++;
+			break;
+		case 2:
+			value = (int)(signed char)(Mem1(pc));
+			value = (value << 8) | (uint)(Mem1(pc + 1));
+			pc += 2;
+			break;
+		case 5:
+		case 9:
+		case 13:
+			value = (uint)(Mem1(pc));
+			pc++;
+			break;
+		case 6:
+		case 10:
+		case 14:
+			value = (uint)Mem2(pc);
+			pc += 2;
+			break;
+		case 3:
+		case 7:
+		case 11:
+		case 15:
+			value = Mem4(pc);
+			pc += 4;
+			break;
+		default:
+			break;
+		}
+		if (mode >= 13)
+			value += ramstart;
+
+		darg->desttype = 0;
+		darg->value = value;
+
+		if (dest->oplist->formlist[ix] == modeform_Load) {
+			switch (mode) {
+			case 0:
+			case 1:
+			case 2:
+			case 3:
+				darg->kind = decoded_Const;
+				break;
+			case 8:
+				darg->kind = decoded_Pop;
+				break;
+			case 5:
+			case 6:
+			case 7:
+			case 13:
+			case 14:
+			case 15:
+				darg->kind = decoded_Mem;
+				break;
+			case 9:
+			case 10:
+			case 11:
+				darg->kind = decoded_Locals;
+				break;
+			default:
+				fatal_error("Unknown addressing mode in load operand.");
+			}
+		} else {
+			darg->kind = decoded_Store;
+			switch (mode) {
+			case 0:
+				break;
+			case 8:
+				darg->desttype = 3;
+				break;
+			case 5:
+			case 6:
+			case 7:
+			case 13:
+			case 14:
+			case 15:
+				darg->desttype = 1;
+				break;
+			case 9:
+			case 10:
+			case 11:
+				darg->desttype = 2;
+				break;
+			case 1:
+			case 2:
+			case 3:
+				fatal_error("Constant addressing mode in store operand.");
+				break;
+			default:
+				fatal_error("Unknown addressing mode in store operand.");
+			}
+		}
+	}
+
+	dest->nextpc = pc;
+	dest->addr = startpc;
+	pc = startpc;
+
+	/* An instruction that runs on past the end of ROM could have its tail
+	   rewritten, so it's decoded afresh every time. */
+	if (dest->nextpc > ramstart)
+		return dest;
+
+	*dop = *dest;
+	return dop;
+}
+
+void Glulx::load_decoded_operands(oparg_t *args, const decodedop_t *dop) {
+	int numops = dop->oplist->num_ops;
+	int argsize = dop->oplist->arg_size;
+	const decodedarg_t *darg = dop->args;
+	oparg_t *curarg = args;
+	uint addr;
+
+	for (int ix = 0; ix < numops; ix++, darg++, curarg++) {
+		curarg->desttype = darg->desttype;
+
+		switch (darg->kind) {
+		case decoded_Pop:
+			if (stackptr < valstackbase + 4) {
+				fatal_error("Stack underflow in operand.");
+			}
+			stackptr -= 4;
+			curarg->value = Stk4(stackptr);
+			break;
+
+		case decoded_Mem:
+			addr = darg->value;
+			if (argsize == 4) {
+				curarg->value = Mem4(addr);
+			} else if (argsize == 2) {
+				curarg->value = Mem2(addr);
+			} else {
+				curarg->value = Mem1(addr);
+			}
+			break;
+
+		case decoded_Locals:
+			addr = darg->value + localsbase;
+			if (argsize == 4) {
+				curarg->value = Stk4(addr);
+			} else if (argsize == 2) {
+				curarg->value = Stk2(addr);
+			} else {
+				curarg->value = Stk1(addr);
+			}
+			break;
+
+		default:
+			/* Constants and store operands were resolved when the
+			   instruction was decoded. */
+			curarg->value = darg->value;
+			break;
+		}
+	}
+}
+
 void Glulx::store_operand(uint desttype, uint destaddr, uint storeval) {
 	switch (desttype) {
 
@@ -0,0 +1,79 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "glk/glulx/glulx.h"
+
+namespace Glk {
+namespace Glulx {
+
+void Glulx::prof_set_active(bool active) {
+	/* Calls made before the profiler was started can't be matched up
+	   with their returns, so tracking starts afresh. */
+	if (active && !prof_active)
+		prof_stack.clear();
+	prof_active = active;
+}
+
+void Glulx::prof_reset() {
+	memset(prof_opcodes, 0, sizeof(prof_opcodes));
+	prof_funcs.clear();
+	for (uint ix = 0; ix < prof_stack.size(); ix++)
+		prof_stack[ix].ops = 0;
+}
+
+void Glulx::prof_enter(uint addr, bool accel) {
+	proffunc_t &func = prof_funcs.getOrCreateVal(addr);
+	func.calls++;
+	func.accel = accel;
+
+	if (!accel) {
+		/* The frame for the new function starts at the current stack
+		   position, so frameptr will match this when it returns. */
+		profframe_t frame;
+		frame.addr = addr;
+		frame.stackuse = stackptr;
+		frame.ops = 0;
+		prof_stack.push_back(frame);
+	}
+}
+
+void Glulx::prof_leave() {
+	prof_unwind();
+
+	if (!prof_stack.empty() && prof_stack.back().stackuse == frameptr) {
+		const profframe_t &frame = prof_stack.back();
+		prof_funcs.getOrCreateVal(frame.addr).ops += frame.ops;
+		prof_stack.pop_back();
+	}
+}
+
+void Glulx::prof_unwind() {
+	/* Any tracked call whose frame lies above the current one has been
+	   discarded without returning normally. */
+	while (!prof_stack.empty() && prof_stack.back().stackuse > frameptr) {
+		const profframe_t &frame = prof_stack.back();
+		prof_funcs.getOrCreateVal(frame.addr).ops += frame.ops;
+		prof_stack.pop_back();
+	}
+}
+
+} // End of namespace Glulx
+} // End of namespace Glk
@@ -30,6 +30,23 @@ enum serop {
 	serop_ReturnIndex       = 0x04
 };
 
+/**
+ * Keys of one, two or four bytes are compared as whole big-endian numbers, which orders
+ * them the same way as comparing their bytes one at a time.
+ */
+static inline bool isNumericKey(uint keysize) {
+	return keysize == 1 || keysize == 2 || keysize == 4;
+}
+
+static inline uint readKey(byte *ptr, uint keysize) {
+	if (keysize == 4)
+		return Read4(ptr);
+	else if (keysize == 2)
+		return Read2(ptr);
+	else
+		return Read1(ptr);
+}
+
 uint Glulx::linear_search(uint key, uint keysize,  uint start, uint structsize, uint numstructs,
 						   uint keyoffset, uint options) {
 	unsigned char keybuf[4];
@@ -40,6 +57,27 @@ uint Glulx::linear_search(uint key, uint keysize,  uint start, uint structsize,
 
 	fetchkey(keybuf, key, keysize, options);
 
+	if (isNumericKey(keysize)) {
+		uint keyval = readKey(keybuf, keysize);
+
+		for (count = 0; count < numstructs; count++, start += structsize) {
+			uint val = readKey(memmap + start + keyoffset, keysize);
+			if (val == keyval) {
+				if (retindex)
+					return count;
+				else
+					return start;
+			}
+			if (zeroterm && val == 0)
+				break;
+		}
+
+		if (retindex)
+			return (uint) - 1;
+		else
+			return 0;
+	}
+
 	for (count = 0; count < numstructs; count++, start += structsize) {
 		int match = true;
 		if (keysize <= 4) {
@@ -92,6 +130,35 @@ uint Glulx::binary_search(uint key, uint keysize,  uint start, uint structsize,
 
 	bot = 0;
 	top = numstructs;
+
+	if (isNumericKey(keysize)) {
+		uint keyval = readKey(keybuf, keysize);
+
+		while (bot < top) {
+			val = (top + bot) / 2;
+			addr = start + val * structsize;
+
+			uint cur = readKey(memmap + addr + keyoffset, keysize);
+			if (cur == keyval) {
+				if (retindex)
+					return val;
+				else
+					return addr;
+			}
+
+			if (cur < keyval) {
+				bot = val + 1;
+			} else {
+				top = val;
+			}
+		}
+
+		if (retindex)
+			return (uint) - 1;
+		else
+			return 0;
+	}
+
 	while (bot < top) {
 		int cmp = 0;
 		val = (top + bot) / 2;
@@ -145,6 +212,23 @@ uint Glulx::linked_search(uint key, uint keysize,  uint start, uint keyoffset, u
 
 	fetchkey(keybuf, key, keysize, options);
 
+	if (isNumericKey(keysize)) {
+		uint keyval = readKey(keybuf, keysize);
+
+		while (start != 0) {
+			uint cur = readKey(memmap + start + keyoffset, keysize);
+			if (cur == keyval)
+				return start;
+			if (zeroterm && cur == 0)
+				break;
+
+			val = start + nextoffset;
+			start = Mem4(val);
+		}
+
+		return 0;
+	}
+
 	while (start != 0) {
 		int match = true;
 		if (keysize <= 4) {
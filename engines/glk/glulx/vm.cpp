@@ -115,6 +115,7 @@ void Glulx::finalize_vm() {
 		stack = nullptr;
 	}
 
+	final_operands();
 	final_serial();
 }
 
@@ -127,6 +128,9 @@ void Glulx::vm_restart() {
 	/* Deactivate the heap (if it was active). */
 	heap_clear();
 
+	/* Any calls the profiler was tracking are gone along with the stack. */
+	prof_stack.clear();
+
 	/* Reset memory to the original size. */
 	lx = change_memsize(origendmem, false);
 	if (lx)
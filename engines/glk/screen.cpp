@@ -96,6 +96,7 @@ void Screen::loadFonts() {
 	}
 
 	loadFonts(archive);
+	resetCharWidths();
 
 	delete archive;
 }
@@ -167,15 +168,26 @@ int Screen::drawString(const Point &pos, int fontIdx, uint color, const Common::
 }
 
 int Screen::drawStringUni(const Point &pos, int fontIdx, uint color, const Common::U32String &text, int spw) {
+	return drawStringUni(pos, fontIdx, color, (const uint32 *)text.c_str(), text.size(), spw);
+}
+
+int Screen::drawStringUni(const Point &pos, int fontIdx, uint color, const uint32 *text, size_t len, int spw) {
 	int baseLine = (fontIdx >= PROPR) ? g_conf->_propInfo._baseLine : g_conf->_monoInfo._baseLine;
 	Point pt(pos.x / GLI_SUBPIX, pos.y - baseLine);
 	const Graphics::Font *font = _fonts[fontIdx];
-	
+
+	// Each character is placed on its own, just as if it were drawn as a one
+	// character string, so that extra space width can be added between them
 	int xSub = pos.x;
-	for (auto c : text) {
+	for (size_t idx = 0; idx < len; ++idx) {
+		uint32 c = text[idx];
 		int xPix = xSub / GLI_SUBPIX;
-		font->drawString(this, Common::U32String(1, c), xPix, pt.y, w - xPix, color);
-		int charWidthPx = font->getStringWidth(Common::U32String(1, c));
+		int x = xPix + font->getKerningOffset(0, c);
+		int right = x + font->getBoundingBox(c).right;
+		if (right <= (int)w + 1 && right >= MAX<int>(xPix, 0))
+			font->drawChar(this, c, x, pt.y, color);
+
+		int charWidthPx = charWidth(font, fontIdx, c) + font->getKerningOffset(0, c);
 		xSub += charWidthPx * GLI_SUBPIX;
 		if (spw > 0 && c == ' ')
 			xSub += spw;
@@ -190,18 +202,34 @@ size_t Screen::stringWidth(int fontIdx, const Common::String &text, int spw) {
 }
 
 size_t Screen::stringWidthUni(int fontIdx, const Common::U32String &text, int spw) {
+	return stringWidthUni(fontIdx, (const uint32 *)text.c_str(), text.size(), spw);
+}
+
+size_t Screen::stringWidthUni(int fontIdx, const uint32 *text, size_t len, int spw) {
 	const Graphics::Font *font = _fonts[fontIdx];
-	size_t width = font->getStringWidth(text)*GLI_SUBPIX;
+	int width = 0;
+	int spaces = 0;
+	uint32 last = 0;
+
+	for (size_t idx = 0; idx < len; ++idx) {
+		uint32 c = text[idx];
+		width += charWidth(font, fontIdx, c) + font->getKerningOffset(last, c);
+		last = c;
+		if (c == ' ')
+			spaces++;
+	}
 
-	if (spw > 0) {
-        int spaces = 0;
-        for (auto c : text)
-            if (c == ' ')
-                spaces++;
+	size_t result = (size_t)width * GLI_SUBPIX;
+	if (spw > 0)
+		result += (size_t)spaces * (size_t)spw;
+	return result;
+}
 
-        width += (size_t)spaces * (size_t)spw;
-    }
-    return width;
+void Screen::resetCharWidths() {
+	// Sub-engines may load fonts past FONTS_TOTAL, so size the cache from what is loaded
+	_charWidths.resize(_fonts.size() * CHAR_WIDTH_CACHE);
+	for (uint idx = 0; idx < _charWidths.size(); ++idx)
+		_charWidths[idx] = -1;
 }
 
 } // End of namespace Glk
@@ -52,8 +52,30 @@ private:
 	 */
 	const Graphics::Font *loadFont(FACES face, Common::Archive *archive,
 		double size, double aspect, int style);
+
+	/**
+	 * Returns the advance width of a character, without any kerning
+	 */
+	int charWidth(const Graphics::Font *font, int fontIdx, uint32 c) {
+		const uint idx = fontIdx * CHAR_WIDTH_CACHE + c;
+		if (c >= CHAR_WIDTH_CACHE || idx >= _charWidths.size())
+			return font->getCharWidth(c);
+
+		int &width = _charWidths[idx];
+		if (width < 0)
+			width = font->getCharWidth(c);
+		return width;
+	}
 protected:
 	Common::Array<const Graphics::Font *> _fonts;
+
+	/**
+	 * Advance widths of the Latin-1 characters in each loaded font, which text
+	 * buffer windows measure over and over while wrapping and drawing their
+	 * lines. Unknown widths are -1.
+	 */
+	enum { CHAR_WIDTH_CACHE = 256 };
+	Common::Array<int> _charWidths;
 protected:
 	/**
 	 * Load the fonts
@@ -115,6 +137,17 @@ public:
 	 */
 	int drawStringUni(const Point &pos, int fontIdx, uint color, const Common::U32String &text, int spw = 0);
 
+	/**
+	 * Draws a run of unicode characters using the specified font at the given co-ordinates
+	 * @param pos       Position for the bottom-left corner the text will be drawn with
+	 * @param fontIdx   Which font to use
+	 * @param color     Text color
+	 * @param text      The characters to draw
+	 * @param len       Number of characters
+	 * @param spw       Extra width added to each space, or 0
+	 */
+	int drawStringUni(const Point &pos, int fontIdx, uint color, const uint32 *text, size_t len, int spw = 0);
+
 	/**
 	 * Get the width in pixels of a string
 	 * @param fontIdx   Which font to use
@@ -132,6 +165,21 @@ public:
 	 * @returns         Width of string multiplied by GLI_SUBPIX
 	 */
 	size_t stringWidthUni(int fontIdx, const Common::U32String &text, int spw = 0);
+
+	/**
+	 * Get the width in pixels of a run of unicode characters
+	 * @param fontIdx   Which font to use
+	 * @param text      The characters to measure
+	 * @param len       Number of characters
+	 * @param spw       Delta X
+	 * @returns         Width of the characters multiplied by GLI_SUBPIX
+	 */
+	size_t stringWidthUni(int fontIdx, const uint32 *text, size_t len, int spw = 0);
+
+	/**
+	 * Forget the cached character widths. This must be called whenever the fonts change
+	 */
+	void resetCharWidths();
 };
 
 } // End of namespace Glk
@@ -36,7 +36,7 @@ namespace Glk {
 
 
 TextBufferWindow::TextBufferWindow(Windows *windows, uint rock) : TextWindow(windows, rock),
-		_font(g_conf->_propInfo), _historyPos(0), _historyFirst(0), _historyPresent(0),
+		_font(g_conf->_propInfo), _picHeight(0), _historyPos(0), _historyFirst(0), _historyPresent(0),
 		_lastSeen(0), _scrollPos(0), _scrollMax(0), _scrollBack(SCROLLBACK), _width(-1), _height(-1),
 		_inBuf(nullptr), _lineTerminators(nullptr), _echoLineInput(true), _ladjw(0), _radjw(0),
 		_ladjn(0), _radjn(0), _numChars(0), _chars(nullptr), _attrs(nullptr), _spaced(0), _dashed(0),
@@ -247,7 +247,9 @@ void TextBufferWindow::touchScroll() {
 	g_vm->_selection->clearSelection();
 	_windows->repaint(_bbox);
 
-	for (int i = 0; i < _scrollMax; i++)
+	// Rows above the visible ones always get fully redrawn when scrolled to
+	int count = MIN(_scrollMax, _scrollPos + _height);
+	for (int i = 0; i < count; i++)
 		_lines[i]._dirty = true;
 }
 
@@ -256,6 +258,7 @@ bool TextBufferWindow::putPicture(Picture *pic, uint align, uint linkval) {
 		if (_lines[0]._rPic || _numChars)
 			return false;
 
+		_picHeight = MAX(_picHeight, (int)pic->h);
 		_radjw = (pic->w + g_conf->_tMarginX) * GLI_SUBPIX;
 		_radjn = (pic->h + _font._cellH - 1) / _font._cellH;
 		_lines[0]._rPic = pic;
@@ -268,6 +271,7 @@ bool TextBufferWindow::putPicture(Picture *pic, uint align, uint linkval) {
 		if (_lines[0]._lPic || _numChars)
 			return false;
 
+		_picHeight = MAX(_picHeight, (int)pic->h);
 		_ladjw = (pic->w + g_conf->_tMarginX) * GLI_SUBPIX;
 		_ladjn = (pic->h + _font._cellH - 1) / _font._cellH;
 		_lines[0]._lPic = pic;
@@ -543,6 +547,7 @@ void TextBufferWindow::clear() {
 
 	_ladjw = _radjw = 0;
 	_ladjn = _radjn = 0;
+	_picHeight = 0;
 
 	_spaced = 0;
 	_dashed = 0;
@@ -826,6 +831,7 @@ void TextBufferWindow::redraw() {
 	int selrow, selchar, sx0, sx1, selleft, selright;
 	bool selBuf;
 	int tx, tsc, tsw, lsc, rsc;
+	Attributes selAttrs[TBLINELEN];
 	Screen &screen = *g_vm->_screen;
 
 	gli_tts_flush();
@@ -863,7 +869,8 @@ void TextBufferWindow::redraw() {
 		if (selrow)
 			_lines[i]._dirty = true;
 
-		TextBufferRow ln(_lines[i]);
+		TextBufferRow &ln = _lines[i];
+		Attributes *attrs = ln._attrs;
 
 		// skip if we can
 		if (!ln._dirty && !ln._repaint && !Windows::_forceRedraw && _scrollPos == 0)
@@ -961,8 +968,11 @@ void TextBufferWindow::redraw() {
 			}
 			// reverse colors for selected chars
 			if (selchar) {
+				Common::copy(ln._attrs, ln._attrs + TBLINELEN, selAttrs);
+				attrs = selAttrs;
+
 				for (tsc = lsc; tsc <= rsc; tsc++) {
-					ln._attrs[tsc].reverse = !ln._attrs[tsc].reverse;
+					selAttrs[tsc].reverse = !selAttrs[tsc].reverse;
 					_copyBuf[_copyPos] = ln._chars[tsc];
 					_copyPos++;
 				}
@@ -988,11 +998,11 @@ void TextBufferWindow::redraw() {
 		x = x0 + SLOP + ln._lm;
 		a = 0;
 		for (b = 0; b < linelen; b++) {
-			if (ln._attrs[a] != ln._attrs[b]) {
-				link = ln._attrs[a].hyper;
-				font = ln._attrs[a].attrFont(_styles);
-				color = ln._attrs[a].attrBg(_styles);
-				w = screen.stringWidthUni(font, Common::U32String((const char32_t *)ln._chars + a, b - a), spw);
+			if (attrs[a] != attrs[b]) {
+				link = attrs[a].hyper;
+				font = attrs[a].attrFont(_styles);
+				color = attrs[a].attrBg(_styles);
+				w = screen.stringWidthUni(font, ln._chars + a, b - a, spw);
 				screen.fillRect(Rect::fromXYWH(x / GLI_SUBPIX, y, w / GLI_SUBPIX, _font._leading),
 								color);
 				if (link) {
@@ -1006,10 +1016,10 @@ void TextBufferWindow::redraw() {
 				a = b;
 			}
 		}
-		link = ln._attrs[a].hyper;
-		font = ln._attrs[a].attrFont(_styles);
-		color = ln._attrs[a].attrBg(_styles);
-		w = screen.stringWidthUni(font, Common::U32String((const char32_t *)ln._chars + a, b - a), spw);
+		link = attrs[a].hyper;
+		font = attrs[a].attrFont(_styles);
+		color = attrs[a].attrBg(_styles);
+		w = screen.stringWidthUni(font, ln._chars + a, b - a, spw);
 		screen.fillRect(Rect::fromXYWH(x / GLI_SUBPIX, y, w / GLI_SUBPIX, _font._leading), color);
 		if (link) {
 			screen.fillRect(Rect::fromXYWH(x / GLI_SUBPIX + 1, y + _font._baseLine + 1,
@@ -1040,19 +1050,19 @@ void TextBufferWindow::redraw() {
 		x = x0 + SLOP + ln._lm;
 		a = 0;
 		for (b = 0; b < linelen; b++) {
-			if (ln._attrs[a] != ln._attrs[b]) {
-				link = ln._attrs[a].hyper;
-				font = ln._attrs[a].attrFont(_styles);
-				color = link ? _font._linkColor : ln._attrs[a].attrFg(_styles);
+			if (attrs[a] != attrs[b]) {
+				link = attrs[a].hyper;
+				font = attrs[a].attrFont(_styles);
+				color = link ? _font._linkColor : attrs[a].attrFg(_styles);
 				x = screen.drawStringUni(Point(x, y + _font._baseLine),
-										 font, color, Common::U32String((const char32_t *)ln._chars + a, b - a), spw);
+										 font, color, ln._chars + a, b - a, spw);
 				a = b;
 			}
 		}
-		link = ln._attrs[a].hyper;
-		font = ln._attrs[a].attrFont(_styles);
-		color = link ? _font._linkColor : ln._attrs[a].attrFg(_styles);
-		screen.drawStringUni(Point(x, y + _font._baseLine), font, color, Common::U32String((const char32_t *)ln._chars + a, linelen - a), spw);
+		link = attrs[a].hyper;
+		font = attrs[a].attrFont(_styles);
+		color = link ? _font._linkColor : attrs[a].attrFg(_styles);
+		screen.drawStringUni(Point(x, y + _font._baseLine), font, color, ln._chars + a, linelen - a, spw);
 	}
 
 	/*
@@ -1093,8 +1103,11 @@ void TextBufferWindow::redraw() {
 	/*
 	 * draw the images
 	 */
-	for (i = 0; i < _scrollBack; i++) {
-		TextBufferRow ln(_lines[i]);
+	// Only rows from the bottom of the window up to the height of the tallest
+	// picture above its top can have a picture showing
+	int lastRow = MIN(_scrollBack - 1, _scrollPos + _height + _picHeight / MAX(_font._leading, 1));
+	for (i = _scrollPos; i <= lastRow; i++) {
+		const TextBufferRow &ln = _lines[i];
 
 		y = y0 + (_height - (i - _scrollPos) - 1) * _font._leading;
 
@@ -1556,11 +1569,19 @@ void TextBufferWindow::scrollOneLine(bool forced) {
 	_lines[0]._len = _numChars;
 	_lines[0]._newLine = forced;
 
-	for (int i = _scrollBack - 1; i > 0; i--) {
-		memcpy(&_lines[i], &_lines[i - 1], sizeof(TextBufferRow));
-		if (i < _height)
-			touch(i);
-	}
+	// The oldest row is recycled as the new row 0
+	TextBufferRow &newRow = _lines.rotate();
+	if (newRow._lPic)
+		newRow._lPic->decrement();
+	if (newRow._rPic)
+		newRow._rPic->decrement();
+	newRow._repaint = false;
+
+	_chars = newRow._chars;
+	_attrs = newRow._attrs;
+
+	for (int i = 1; i < _height && i < _scrollBack; i++)
+		touch(i);
 
 	if (_radjn)
 		_radjn--;
@@ -1627,12 +1648,12 @@ int TextBufferWindow::calcWidth(const uint32 *chars, const Attributes *attrs, in
 	for (b = startchar; b < numChars; b++) {
 		if (attrs[a] != attrs[b]) {
 			w += screen.stringWidthUni(attrs[a].attrFont(_styles),
-									   Common::U32String((const char32_t *)chars + a, b - a), spw);
+									   chars + a, b - a, spw);
 			a = b;
 		}
 	}
 
-	w += screen.stringWidthUni(attrs[a].attrFont(_styles), Common::U32String((const char32_t *)chars + a, b - a), spw);
+	w += screen.stringWidthUni(attrs[a].attrFont(_styles), chars + a, b - a, spw);
 
 	return w;
 }
@@ -1657,4 +1678,27 @@ TextBufferWindow::TextBufferRow::TextBufferRow() : _len(0), _newLine(0), _dirty(
 	Common::fill(&_chars[0], &_chars[TBLINELEN], 0);
 }
 
+/*--------------------------------------------------------------------------*/
+
+void TextBufferWindow::TextBufferRows::resize(uint newSize) {
+	if (_first) {
+		// Put the rows back into order before adding or removing any
+		Common::Array<TextBufferRow> rows;
+		rows.reserve(newSize);
+		for (uint idx = 0; idx < _rows.size(); ++idx)
+			rows.push_back((*this)[idx]);
+
+		_rows.swap(rows);
+		_first = 0;
+	}
+
+	_rows.resize(newSize);
+}
+
+TextBufferWindow::TextBufferRow &TextBufferWindow::TextBufferRows::rotate() {
+	assert(!_rows.empty());
+	_first = (_first ? _first : _rows.size()) - 1;
+	return _rows[_first];
+}
+
 } // End of namespace Glk
@@ -52,9 +52,47 @@ class TextBufferWindow : public TextWindow, Speech {
 		 */
 		TextBufferRow();
 	};
-	typedef Common::Array<TextBufferRow> TextBufferRows;
+
+	/**
+	 * The rows of the window, with row 0 being the one currently being written to. The rows
+	 * are kept in a ring, so scrolling a new row in doesn't have to move the whole scrollback
+	 */
+	class TextBufferRows {
+	private:
+		Common::Array<TextBufferRow> _rows;
+		uint _first;    ///< Index within _rows of row 0
+	public:
+		/**
+		 * Constructor
+		 */
+		TextBufferRows() : _first(0) {}
+
+		/**
+		 * Returns the number of rows
+		 */
+		uint size() const { return _rows.size(); }
+
+		/**
+		 * Returns a given row
+		 */
+		TextBufferRow &operator[](uint idx) {
+			idx += _first;
+			return _rows[idx < _rows.size() ? idx : idx - _rows.size()];
+		}
+
+		/**
+		 * Changes the number of rows. Existing rows keep their positions
+		 */
+		void resize(uint newSize);
+
+		/**
+		 * Shifts every row up by one, and returns the new row 0, which was previously the last row
+		 */
+		TextBufferRow &rotate();
+	};
 private:
 	PropFontInfo &_font;
+	int _picHeight;     ///< Height of the tallest picture in the scrollback
 private:
 	void reflow();
 	void touchScroll();
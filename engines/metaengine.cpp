@@ -386,6 +386,10 @@ SaveStateList MetaEngine::listSaves(const char *target) const {
 	if (!hasFeature(kSavesUseExtendedFormat))
 		return SaveStateList();
 
+	// A save still being written out would be listed truncated
+	if (g_engine)
+		g_engine->flushPendingSave();
+
 	Common::SaveFileManager *saveFileMan = g_system->getSavefileManager();
 	Common::StringArray filenames;
 	Common::String pattern(getSavegameFilePattern(target));
@@ -473,22 +477,43 @@ SaveStateDescriptor MetaEngine::querySaveMetaInfos(const char *target, int slot)
 	if (!hasFeature(kSavesUseExtendedFormat))
 		return SaveStateDescriptor();
 
-	Common::ScopedPtr<Common::InSaveFile> f(g_system->getSavefileManager()->openForLoading(
-		getSavegameFile(slot, target)));
+	if (g_engine)
+		g_engine->flushPendingSave();
 
-	if (f) {
-		ExtendedSavegameHeader header;
-		if (!readSavegameHeader(f.get(), &header, false)) {
+	Common::SaveFileManager *saveFileMan = g_system->getSavefileManager();
+	const Common::String filename = getSavegameFile(slot, target);
+
+	// Reading the header requires decompressing the whole file, so the
+	// results are kept in the save file manager's index.
+	Common::SavefileMetadata metadata;
+	if (!saveFileMan->getSavefileMetadata(filename, metadata)) {
+		Common::ScopedPtr<Common::InSaveFile> f(saveFileMan->openForLoading(filename));
+		if (!f)
 			return SaveStateDescriptor();
-		}
 
-		// Create the return descriptor
-		SaveStateDescriptor desc(this, slot);
-		parseSavegameHeader(&header, &desc);
-		desc.setThumbnail(header.thumbnail);
-		desc.setAutosave(header.isAutosave);
-		return desc;
+		ExtendedSavegameHeader header;
+		metadata.hasHeader = readSavegameHeader(f.get(), &header);
+		metadata.description = header.description;
+		metadata.date = header.date;
+		metadata.time = header.time;
+		metadata.playtime = header.playtime;
+		metadata.isAutosave = header.isAutosave;
+		saveFileMan->setSavefileMetadata(filename, metadata);
 	}
 
-	return SaveStateDescriptor();
+	if (!metadata.hasHeader)
+		return SaveStateDescriptor();
+
+	ExtendedSavegameHeader header;
+	header.description = metadata.description;
+	header.date = metadata.date;
+	header.time = metadata.time;
+	header.playtime = metadata.playtime;
+
+	// Create the return descriptor. The thumbnail is only read when needed.
+	SaveStateDescriptor desc(this, slot);
+	parseSavegameHeader(&header, &desc);
+	desc.setThumbnailFile(filename);
+	desc.setAutosave(metadata.isAutosave);
+	return desc;
 }
@@ -45,6 +45,7 @@
 #ifdef ENABLE_RIVEN
 #include "mohawk/riven.h"
 #include "mohawk/riven_card.h"
+#include "mohawk/riven_graphics.h"
 #include "mohawk/riven_sound.h"
 #include "mohawk/riven_stack.h"
 #include "mohawk/riven_stacks/domespit.h"
@@ -392,6 +393,7 @@ RivenConsole::RivenConsole(MohawkEngine_Riven *vm) : GUI::Debugger(), _vm(vm) {
 	registerCmd("combos",         WRAP_METHOD(RivenConsole, Cmd_Combos));
 	registerCmd("sliderState",    WRAP_METHOD(RivenConsole, Cmd_SliderState));
 	registerCmd("quickTest",      WRAP_METHOD(RivenConsole, Cmd_QuickTest));
+	registerCmd("imageCache",     WRAP_METHOD(RivenConsole, Cmd_ImageCache));
 	registerVar("show_hotspots",  &_vm->_showHotspots);
 }
 
@@ -535,6 +537,26 @@ bool RivenConsole::Cmd_ZipMode(int argc, const char **argv) {
 	return true;
 }
 
+bool RivenConsole::Cmd_ImageCache(int argc, const char **argv) {
+	if (argc == 3 && !scumm_stricmp(argv[1], "budget")) {
+		_vm->_gfx->setCacheBudget(atoi(argv[2]) * 1024);
+		_vm->_gfx->trimCache();
+	} else if (argc == 2 && !scumm_stricmp(argv[1], "reset")) {
+		_vm->_gfx->resetCacheStats();
+	} else if (argc != 1) {
+		debugPrintf("Usage: imageCache [budget <KB> | reset]\n");
+		return true;
+	}
+
+	const GraphicsManager::CacheStats &stats = _vm->_gfx->getCacheStats();
+	debugPrintf("Images: %d cached, %d KB of %d KB budget\n", _vm->_gfx->getCachedImageCount(),
+	            _vm->_gfx->getCacheSize() / 1024, _vm->_gfx->getCacheBudget() / 1024);
+	debugPrintf("Lookups: %d hits, %d misses, %d evictions\n", stats.hits, stats.misses, stats.evictions);
+	debugPrintf("Prefetch: %d decoded, %d used, %d pending\n", stats.prefetched, stats.prefetchHits,
+	            _vm->_gfx->getPendingPrefetchCount());
+	return true;
+}
+
 bool RivenConsole::Cmd_DumpCard(int argc, const char **argv) {
 	if (argc != 1) {
 		debugPrintf("Usage: dumpCard\n");
@@ -67,7 +67,12 @@ void MohawkSurface::convertToTrueColor() {
 	_surface = surface;
 }
 
-GraphicsManager::GraphicsManager() {
+GraphicsManager::GraphicsManager() :
+		_cacheSize(0),
+		_cacheBudget(kDefaultCacheBudget),
+		_useCounter(0),
+		_trimUseCounter(0) {
+	resetCacheStats();
 }
 
 GraphicsManager::~GraphicsManager() {
@@ -75,8 +80,8 @@ GraphicsManager::~GraphicsManager() {
 }
 
 void GraphicsManager::clearCache() {
-	for (Common::HashMap<uint16, MohawkSurface *>::iterator it = _cache.begin(); it != _cache.end(); it++)
-		delete it->_value;
+	for (Common::HashMap<uint16, CachedImage>::iterator it = _cache.begin(); it != _cache.end(); it++)
+		delete it->_value.surface;
 	for (Common::HashMap<uint16, Common::Array<MohawkSurface *> >::iterator it = _subImageCache.begin(); it != _subImageCache.end(); it++) {
 		Common::Array<MohawkSurface *> &array = it->_value;
 		for (uint i = 0; i < array.size(); i++)
@@ -85,18 +90,121 @@ void GraphicsManager::clearCache() {
 
 	_cache.clear();
 	_subImageCache.clear();
+	_prefetchList.clear();
+	_cacheSize = 0;
+	_trimUseCounter = _useCounter;
+}
+
+void GraphicsManager::trimCache() {
+	// Everything has been used before this point, so any entry may go
+	_trimUseCounter = ++_useCounter;
+	_prefetchList.clear();
+
+	while (_cacheSize > _cacheBudget && evictLeastRecentlyUsed(_trimUseCounter))
+		;
+}
+
+bool GraphicsManager::evictLeastRecentlyUsed(uint32 usedBefore) {
+	Common::HashMap<uint16, CachedImage>::iterator oldest = _cache.end();
+	for (Common::HashMap<uint16, CachedImage>::iterator it = _cache.begin(); it != _cache.end(); it++) {
+		if (it->_value.lastUse >= usedBefore)
+			continue;
+		if (oldest == _cache.end() || it->_value.lastUse < oldest->_value.lastUse)
+			oldest = it;
+	}
+
+	if (oldest == _cache.end())
+		return false;
+
+	_cacheSize -= oldest->_value.size;
+	delete oldest->_value.surface;
+	_cache.erase(oldest);
+	_cacheStats.evictions++;
+	return true;
+}
+
+void GraphicsManager::insertImage(uint16 id, MohawkSurface *surface, bool prefetched) {
+	CachedImage &entry = _cache[id];
+	entry.surface = surface;
+	entry.size = 0;
+	entry.lastUse = ++_useCounter;
+	entry.prefetched = prefetched;
+
+	Graphics::Surface *pixels = surface ? surface->getSurface() : nullptr;
+	if (pixels)
+		entry.size = pixels->h * pixels->pitch;
+	if (surface && surface->getPalette())
+		entry.size += 256 * 3;
+
+	_cacheSize += entry.size;
 }
 
 MohawkSurface *GraphicsManager::findImage(uint16 id) {
-	if (!_cache.contains(id))
-		_cache[id] = decodeImage(id);
+	Common::HashMap<uint16, CachedImage>::iterator it = _cache.find(id);
+	if (it == _cache.end()) {
+		_cacheStats.misses++;
+		insertImage(id, decodeImage(id), false);
+		return _cache[id].surface;
+	}
 
-	// TODO: Probably would be nice to limit the size of the cache
-	// Currently, this can't get large because it is freed on every
-	// card/stack change in Myst/Riven so I'm not worried about it.
-	// Doesn't mean this shouldn't be done in the future.
+	// Surfaces are never evicted here as callers may still hold pointers
+	// to other cached images. The size is kept in check by trimCache().
+	_cacheStats.hits++;
+	if (it->_value.prefetched) {
+		_cacheStats.prefetchHits++;
+		it->_value.prefetched = false;
+	}
+	it->_value.lastUse = ++_useCounter;
+	return it->_value.surface;
+}
+
+void GraphicsManager::setPrefetchList(const Common::Array<uint16> &images) {
+	_prefetchList.clear();
+
+	// Decode in the given order, prefetchNextImage() pops from the back
+	for (uint i = images.size(); i > 0; i--) {
+		if (!_cache.contains(images[i - 1]))
+			_prefetchList.push_back(images[i - 1]);
+	}
+}
+
+bool GraphicsManager::prefetchNextImage() {
+	while (!_prefetchList.empty()) {
+		uint16 id = _prefetchList.back();
+		_prefetchList.pop_back();
+
+		if (_cache.contains(id))
+			continue;
+
+		MohawkSurface *surface = decodeImage(id);
+		insertImage(id, surface, true);
+
+		// Only images not used since the last trim can make room
+		while (_cacheSize > _cacheBudget && evictLeastRecentlyUsed(_trimUseCounter))
+			;
+
+		if (_cacheSize > _cacheBudget) {
+			// The budget is full of images needed by the current card
+			_cacheSize -= _cache[id].size;
+			_cache.erase(id);
+			delete surface;
+			_prefetchList.clear();
+			return false;
+		}
+
+		_cacheStats.prefetched++;
+		return true;
+	}
+
+	return false;
+}
 
-	return _cache[id];
+void GraphicsManager::resetCacheStats() {
+	_cacheStats.hits = 0;
+	_cacheStats.misses = 0;
+	_cacheStats.prefetched = 0;
+	_cacheStats.prefetchHits = 0;
+	_cacheStats.evictions = 0;
 }
 
 Common::Array<MohawkSurface *> GraphicsManager::decodeImages(uint16 id) {
@@ -226,7 +334,7 @@ void GraphicsManager::addImageToCache(uint16 id, MohawkSurface *surface) {
 	if (_cache.contains(id))
 		error("Image %d already in cache", id);
 
-	_cache[id] = surface;
+	insertImage(id, surface, false);
 }
 
 } // End of namespace Mohawk
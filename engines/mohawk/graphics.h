@@ -73,6 +73,35 @@ public:
 	// Free all surfaces in the cache
 	void clearCache();
 
+	// Free the least recently used surfaces until the cache fits in its
+	// memory budget. Surfaces used after this call are kept while prefetching.
+	void trimCache();
+
+	// Memory budget of the decoded image cache, in bytes
+	void setCacheBudget(uint32 budget) { _cacheBudget = budget; }
+	uint32 getCacheBudget() const { return _cacheBudget; }
+
+	// Replace the list of images to decode ahead of their first use
+	void setPrefetchList(const Common::Array<uint16> &images);
+
+	// Decode the next image of the prefetch list if it fits in the budget.
+	// Returns false when there is nothing left to prefetch.
+	bool prefetchNextImage();
+
+	struct CacheStats {
+		uint32 hits;
+		uint32 misses;
+		uint32 prefetched;
+		uint32 prefetchHits;
+		uint32 evictions;
+	};
+
+	const CacheStats &getCacheStats() const { return _cacheStats; }
+	void resetCacheStats();
+	uint32 getCacheSize() const { return _cacheSize; }
+	uint32 getCachedImageCount() const { return _cache.size(); }
+	uint32 getPendingPrefetchCount() const { return _prefetchList.size(); }
+
 	// findImage will search the cache to find the image.
 	// If not found, it will call decodeImage to get a new one.
 	MohawkSurface *findImage(uint16 id);
@@ -96,8 +125,27 @@ protected:
 	void addImageToCache(uint16 id, MohawkSurface *surface);
 
 private:
-	// An image cache that stores images until clearCache() is called
-	Common::HashMap<uint16, MohawkSurface *> _cache;
+	struct CachedImage {
+		MohawkSurface *surface;
+		uint32 size;
+		uint32 lastUse;
+		bool prefetched;
+	};
+
+	static const uint32 kDefaultCacheBudget = 24 * 1024 * 1024;
+
+	void insertImage(uint16 id, MohawkSurface *surface, bool prefetched);
+	bool evictLeastRecentlyUsed(uint32 usedBefore);
+
+	// An image cache that stores images until they are evicted by trimCache()
+	// or clearCache() is called
+	Common::HashMap<uint16, CachedImage> _cache;
+	uint32 _cacheSize;
+	uint32 _cacheBudget;
+	uint32 _useCounter;
+	uint32 _trimUseCounter;
+	CacheStats _cacheStats;
+	Common::Array<uint16> _prefetchList;
 	Common::HashMap<uint16, Common::Array<MohawkSurface *> > _subImageCache;
 };
 
@@ -125,6 +125,8 @@ Common::Error MohawkEngine_Riven::run() {
 		SearchMan.add("arcriven.z", &_installerArchive, 0, false);
 
 	_gfx = new RivenGraphics(this);
+	if (ConfMan.hasKey("riven_image_cache_kb"))
+		_gfx->setCacheBudget(ConfMan.getInt("riven_image_cache_kb") * 1024);
 	_video = new RivenVideoManager(this);
 	_sound = new RivenSoundManager(this);
 	setDebugger(new RivenConsole(this));
@@ -229,6 +231,12 @@ void MohawkEngine_Riven::doFrame() {
 	_system->updateScreen();
 	uint32 loopElapsed = _system->getMillis() - loopStart;
 
+	// Use the spare time of idle frames to decode one prefetched picture
+	if (loopElapsed < 10 && !_scriptMan->hasQueuedScripts()) {
+		_gfx->prefetchNextImage();
+		loopElapsed = _system->getMillis() - loopStart;
+	}
+
 	// Cut down on CPU usage
 	if (loopElapsed < 10)
 		_system->delayMillis(10 - loopElapsed);
@@ -613,9 +621,9 @@ static const RivenSpecialChange rivenSpecialChange[] = {
 void MohawkEngine_Riven::changeToCard(uint16 dest) {
 	debug (1, "Changing to card %d", dest);
 
-	// Clear the graphics cache (images typically aren't used
-	// on different cards).
-	_gfx->clearCache();
+	// Keep the most recently used images within the cache budget,
+	// they are often shared between neighbouring cards.
+	_gfx->trimCache();
 
 	if (!isGameVariant(GF_DEMO)) {
 		for (byte i = 0; i < ARRAYSIZE(rivenSpecialChange); i++)
@@ -636,6 +644,11 @@ void MohawkEngine_Riven::changeToCard(uint16 dest) {
 	_card = new RivenCard(this, dest);
 	_card->enter(true);
 
+	// Decode the pictures of the cards reachable from here while idle
+	Common::Array<uint16> prefetchImages;
+	_card->listReachableCardImages(prefetchImages);
+	_gfx->setPrefetchList(prefetchImages);
+
 	// Now we need to redraw the cursor if necessary and handle mouse over scripts
 	_stack->queueMouseCursorRefresh();
 
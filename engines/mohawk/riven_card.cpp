@@ -715,6 +715,52 @@ void RivenCard::loadCardPictureList(uint16 id) {
 	delete plst;
 }
 
+void RivenCard::listReachableCardImages(Common::Array<uint16> &images) const {
+	Common::Array<uint16> cards;
+	for (uint i = 0; i < _hotspots.size(); i++) {
+		if (!_hotspots[i]->isEnabled())
+			continue;
+
+		RivenScriptPtr mouseDownScript = _hotspots[i]->getScript(kMouseDownScript);
+		if (mouseDownScript)
+			mouseDownScript->listCardDestinations(cards);
+
+		RivenScriptPtr mouseUpScript = _hotspots[i]->getScript(kMouseUpScript);
+		if (mouseUpScript)
+			mouseUpScript->listCardDestinations(cards);
+	}
+
+	Common::Array<uint16> otherImages;
+	Common::Array<uint16> visited;
+	for (uint i = 0; i < cards.size(); i++) {
+		uint16 card = cards[i];
+		if (card == _id || Common::find(visited.begin(), visited.end(), card) != visited.end())
+			continue;
+		visited.push_back(card);
+
+		if (!_vm->hasResource(ID_PLST, card))
+			continue;
+
+		Common::SeekableReadStream *plst = _vm->getResource(ID_PLST, card);
+		uint16 recordCount = plst->readUint16BE();
+
+		for (uint16 j = 0; j < recordCount; j++) {
+			plst->readUint16BE(); // index
+			uint16 id = plst->readUint16BE();
+			plst->skip(8); // rect
+
+			if (j == 0)
+				images.push_back(id);
+			else
+				otherImages.push_back(id);
+		}
+
+		delete plst;
+	}
+
+	images.push_back(otherImages);
+}
+
 void RivenCard::drawPicture(uint16 index, bool queue) {
 	if (index > 0 && index <= _pictureList.size()) {
 		RivenScriptPtr script = _vm->_scriptMan->createScriptFromData(1, kRivenCommandActivatePLST, 1, index);
@@ -139,6 +139,14 @@ public:
 	/** Frame update handler for mouse dragging */
 	RivenScriptPtr onMouseDragUpdate();
 
+	/**
+	 * List the pictures of the cards the enabled hotspots can change to
+	 *
+	 * The first picture of each card comes first, as it is the one usually
+	 * drawn when entering the card.
+	 */
+	void listReachableCardImages(Common::Array<uint16> &images) const;
+
 	/** Write all of the card's data to standard output */
 	void dump() const;
 
@@ -217,6 +217,12 @@ void RivenScript::dumpScript(byte tabs) {
 	}
 }
 
+void RivenScript::listCardDestinations(Common::Array<uint16> &cards) const {
+	for (uint i = 0; i < _commands.size(); i++) {
+		_commands[i]->listCardDestinations(cards);
+	}
+}
+
 void RivenScript::run(RivenScriptManager *scriptManager) {
 	for (uint i = 0; i < _commands.size(); i++) {
 		if (scriptManager->stoppingAllScripts()) {
@@ -830,6 +836,12 @@ RivenCommandType RivenSimpleCommand::getType() const {
 	return _type;
 }
 
+void RivenSimpleCommand::listCardDestinations(Common::Array<uint16> &cards) const {
+	if (_type == kRivenCommandChangeCard && !_arguments.empty()) {
+		cards.push_back(_arguments[0]);
+	}
+}
+
 RivenSwitchCommand::RivenSwitchCommand(MohawkEngine_Riven *vm) :
 		RivenCommand(vm),
 		_variableId(0) {
@@ -917,6 +929,12 @@ void RivenSwitchCommand::applyCardPatches(uint32 globalId, int scriptType, uint1
 	}
 }
 
+void RivenSwitchCommand::listCardDestinations(Common::Array<uint16> &cards) const {
+	for (uint i = 0; i < _branches.size(); i++) {
+		_branches[i].script->listCardDestinations(cards);
+	}
+}
+
 RivenStackChangeCommand::RivenStackChangeCommand(MohawkEngine_Riven *vm, uint16 stackId, uint32 globalCardId,
 												 bool byStackId, bool byStackCardId) :
 		RivenCommand(vm),
@@ -1433,6 +1433,7 @@ CORO_BEGIN_DEFINITION(MToonElement::MToonConsumeCommandCoroutine)
 
 			if (self->_isStopped) {
 				self->_isStopped = false;
+				self->_contentsDirty = true;
 				params->runtime->setSceneGraphDirty();
 			}
 
@@ -1638,6 +1639,16 @@ bool MToonElement::isMouseCollisionAtPoint(int32 relativeX, int32 relativeY) con
 	return false;
 }
 
+Common::Rect MToonElement::getRelativeRenderBounds() const {
+	Common::Rect bounds = VisualElement::getRelativeRenderBounds();
+
+	// Frames are drawn at their own offset, which may reach outside of the element rect
+	if (_metadata && _cel >= 1 && static_cast<uint32>(_cel) <= _metadata->frames.size())
+		bounds.extend(_metadata->frames[_cel - 1].rect);
+
+	return bounds;
+}
+
 Common::Rect MToonElement::getRelativeCollisionRect() const {
 	Common::Rect colRect = _metadata->frames[_renderedFrame].rect;
 	colRect.translate(_rect.left, _rect.top);
@@ -249,6 +249,7 @@ public:
 
 	bool isMouseCollisionAtPoint(int32 relativeX, int32 relativeY) const override;
 
+	Common::Rect getRelativeRenderBounds() const override;
 	Common::Rect getRelativeCollisionRect() const override;
 
 	Common::SharedPtr<Structural> shallowClone() const override;
@@ -78,9 +78,19 @@ bool miniscriptEvaluateTruth(const DynamicValue &value) {
 IMiniscriptInstructionParserFeedback::~IMiniscriptInstructionParserFeedback() {
 }
 
+MiniscriptInstruction::MiniscriptInstruction() : _fastOp(kFastOpNone) {
+}
+
+MiniscriptInstruction::MiniscriptInstruction(FastOp fastOp) : _fastOp(fastOp) {
+}
+
 MiniscriptInstruction::~MiniscriptInstruction() {
 }
 
+MiniscriptInstruction::FastOp MiniscriptInstruction::getFastOp() const {
+	return _fastOp;
+}
+
 MiniscriptReferences::LocalRef::LocalRef() : guid(0) {
 }
 
@@ -163,6 +173,13 @@ const Common::Array<MiniscriptProgram::Attribute> &MiniscriptProgram::getAttribu
 	return _attributes;
 }
 
+MiniscriptProgram::ProfileStats &MiniscriptProgram::getProfileStats() {
+	return _profileStats;
+}
+
+MiniscriptProgram::ProfileStats::ProfileStats() : runs(0), failures(0), instructions(0), fastOps(0) {
+}
+
 template<class T>
 struct MiniscriptInstructionLoader {
 	static bool loadInstruction(void *dest, uint32 instrFlags, Data::DataReader &instrDataReader, IMiniscriptInstructionParserFeedback &feedback);
@@ -638,6 +655,9 @@ MiniscriptInstructionOutcome Send::execute(MiniscriptThread *thread) const {
 	}
 }
 
+BinaryArithInstruction::BinaryArithInstruction(FastOp fastOp) : MiniscriptInstruction(fastOp) {
+}
+
 MiniscriptInstructionOutcome BinaryArithInstruction::execute(MiniscriptThread *thread) const {
 	if (thread->getStackSize() < 2) {
 		thread->error("Stack underflow");
@@ -1735,7 +1755,9 @@ MiniscriptInstructionOutcome ListAppend::execute(MiniscriptThread *thread) const
 }
 
 MiniscriptInstructionOutcome PushValue::execute(MiniscriptThread *thread) const {
-	DynamicValue value;
+	thread->pushValue(DynamicValue());
+
+	DynamicValue &value = thread->getStackValueFromTop(0).value;
 
 	switch (_dataType) {
 	case DataType::kDataTypeNull:
@@ -1764,8 +1786,6 @@ MiniscriptInstructionOutcome PushValue::execute(MiniscriptThread *thread) const
 		break;
 	}
 
-	thread->pushValue(value);
-
 	return kMiniscriptInstructionOutcomeContinue;
 }
 
@@ -2052,6 +2072,7 @@ CORO_BEGIN_DEFINITION(MiniscriptThread::ResumeThreadCoroutine)
 	CORO_BEGIN_FUNCTION
 		locals->self = params->thread.get();
 		locals->numInstrs = locals->self->_program->getInstructions().size();
+		locals->self->_program->getProfileStats().runs++;
 
 		CORO_IF (locals->numInstrs == 0)
 			CORO_RETURN;
@@ -2066,10 +2087,20 @@ CORO_END_DEFINITION
 MiniscriptInstructionOutcome MiniscriptThread::runNextInstruction() {
 	const MiniscriptInstruction *instr = _program->getInstructions()[_currentInstruction++];
 
+	MiniscriptProgram::ProfileStats &stats = _program->getProfileStats();
+	stats.instructions++;
+
+	MiniscriptInstruction::FastOp fastOp = instr->getFastOp();
+	if (fastOp != MiniscriptInstruction::kFastOpNone && tryRunFastOp(fastOp)) {
+		stats.fastOps++;
+		return kMiniscriptInstructionOutcomeContinue;
+	}
+
 	MiniscriptInstructionOutcome outcome = instr->execute(this);
 
 	if (outcome == kMiniscriptInstructionOutcomeFailed) {
 		// Treat this as non-fatal but bail out of the execution loop
+		stats.failures++;
 		_failed = true;
 		return kMiniscriptInstructionOutcomeContinue;
 	}
@@ -2078,6 +2109,76 @@ MiniscriptInstructionOutcome MiniscriptThread::runNextInstruction() {
 	return outcome;
 }
 
+bool MiniscriptThread::tryRunFastOp(MiniscriptInstruction::FastOp fastOp) {
+	// Only plain integers and floats are handled here, they need no dereferencing and
+	// can't fail, everything else goes through the instruction's full implementation.
+	size_t stackSize = _stack.size();
+	if (stackSize < 2)
+		return false;
+
+	DynamicValue &rs = _stack[stackSize - 1].value;
+	DynamicValue &lsDest = _stack[stackSize - 2].value;
+
+	double left = 0.0;
+	if (lsDest.getType() == DynamicValueTypes::kInteger)
+		left = lsDest.getInt();
+	else if (lsDest.getType() == DynamicValueTypes::kFloat)
+		left = lsDest.getFloat();
+	else
+		return false;
+
+	double right = 0.0;
+	if (rs.getType() == DynamicValueTypes::kInteger)
+		right = rs.getInt();
+	else if (rs.getType() == DynamicValueTypes::kFloat)
+		right = rs.getFloat();
+	else
+		return false;
+
+	switch (fastOp) {
+	case MiniscriptInstruction::kFastOpAdd:
+		lsDest.setFloat(left + right);
+		break;
+	case MiniscriptInstruction::kFastOpSub:
+		lsDest.setFloat(left - right);
+		break;
+	case MiniscriptInstruction::kFastOpMul:
+		lsDest.setFloat(left * right);
+		break;
+	case MiniscriptInstruction::kFastOpDiv:
+		// Let the instruction report the error
+		if (right == 0.0)
+			return false;
+		lsDest.setFloat(left / right);
+		break;
+	case MiniscriptInstruction::kFastOpCmpEqual:
+		// Comparisons against NaN are undefined and always false
+		lsDest.setBool(!isnan(left) && !isnan(right) && left == right);
+		break;
+	case MiniscriptInstruction::kFastOpCmpNotEqual:
+		lsDest.setBool(!isnan(left) && !isnan(right) && left != right);
+		break;
+	case MiniscriptInstruction::kFastOpCmpLess:
+		lsDest.setBool(left < right);
+		break;
+	case MiniscriptInstruction::kFastOpCmpLessOrEqual:
+		lsDest.setBool(left <= right);
+		break;
+	case MiniscriptInstruction::kFastOpCmpGreater:
+		lsDest.setBool(left > right);
+		break;
+	case MiniscriptInstruction::kFastOpCmpGreaterOrEqual:
+		lsDest.setBool(left >= right);
+		break;
+	default:
+		return false;
+	}
+
+	_stack.pop_back();
+
+	return true;
+}
+
 MiniscriptInstructionOutcome MiniscriptThread::tryLoadVariable(MiniscriptStackValue &stackValue) {
 	if (stackValue.value.getType() == DynamicValueTypes::kObject) {
 		Common::SharedPtr<RuntimeObject> obj = stackValue.value.getObject().object.lock();
@@ -35,9 +35,33 @@ bool miniscriptEvaluateTruth(const DynamicValue &value);
 
 class MiniscriptInstruction {
 public:
+	// Operations that the thread can run inline when both operands are plain numbers
+	enum FastOp {
+		kFastOpNone,
+
+		kFastOpAdd,
+		kFastOpSub,
+		kFastOpMul,
+		kFastOpDiv,
+
+		kFastOpCmpEqual,
+		kFastOpCmpNotEqual,
+		kFastOpCmpLess,
+		kFastOpCmpLessOrEqual,
+		kFastOpCmpGreater,
+		kFastOpCmpGreaterOrEqual,
+	};
+
+	MiniscriptInstruction();
+	explicit MiniscriptInstruction(FastOp fastOp);
 	virtual ~MiniscriptInstruction();
 
 	virtual MiniscriptInstructionOutcome execute(MiniscriptThread *thread) const = 0;
+
+	FastOp getFastOp() const;
+
+private:
+	FastOp _fastOp;
 };
 
 class IMiniscriptInstructionParserFeedback {
@@ -85,16 +109,29 @@ public:
 		Common::String name;
 	};
 
+	// Execution counts, shared by all modifiers running this program
+	struct ProfileStats {
+		ProfileStats();
+
+		uint32 runs;
+		uint32 failures;
+		uint64 instructions;
+		uint64 fastOps;
+	};
+
 	MiniscriptProgram(const Common::SharedPtr<Common::Array<uint8> > &programData, const Common::Array<MiniscriptInstruction *> &instructions, const Common::Array<Attribute> &attributes);
 	~MiniscriptProgram();
 
 	const Common::Array<MiniscriptInstruction *> &getInstructions() const;
 	const Common::Array<Attribute> &getAttributes() const;
 
+	ProfileStats &getProfileStats();
+
 private:
 	Common::SharedPtr<Common::Array<uint8> > _programData;
 	Common::Array<MiniscriptInstruction *> _instructions;
 	Common::Array<Attribute> _attributes;
+	ProfileStats _profileStats;
 };
 
 class MiniscriptParser {
@@ -138,6 +175,9 @@ namespace MiniscriptInstructions {
 	};
 
 	class BinaryArithInstruction : public MiniscriptInstruction {
+	public:
+		explicit BinaryArithInstruction(FastOp fastOp);
+
 	private:
 		MiniscriptInstructionOutcome execute(MiniscriptThread *thread) const override;
 
@@ -146,36 +186,57 @@ namespace MiniscriptInstructions {
 	};
 
 	class Add : public BinaryArithInstruction {
+	public:
+		Add() : BinaryArithInstruction(kFastOpAdd) {}
+
 	private:
 		MiniscriptInstructionOutcome arithExecute(MiniscriptThread *thread, double &result, double left, double right) const override;
 	};
 
 	class Sub : public BinaryArithInstruction {
+	public:
+		Sub() : BinaryArithInstruction(kFastOpSub) {}
+
 	private:
 		MiniscriptInstructionOutcome arithExecute(MiniscriptThread *thread, double &result, double left, double right) const override;
 	};
 
 	class Mul : public BinaryArithInstruction {
+	public:
+		Mul() : BinaryArithInstruction(kFastOpMul) {}
+
 	private:
 		MiniscriptInstructionOutcome arithExecute(MiniscriptThread *thread, double &result, double left, double right) const override;
 	};
 
 	class Div : public BinaryArithInstruction {
+	public:
+		Div() : BinaryArithInstruction(kFastOpDiv) {}
+
 	private:
 		MiniscriptInstructionOutcome arithExecute(MiniscriptThread *thread, double &result, double left, double right) const override;
 	};
 
 	class Pow : public BinaryArithInstruction {
+	public:
+		Pow() : BinaryArithInstruction(kFastOpNone) {}
+
 	private:
 		MiniscriptInstructionOutcome arithExecute(MiniscriptThread *thread, double &result, double left, double right) const override;
 	};
 
 	class DivInt : public BinaryArithInstruction {
+	public:
+		DivInt() : BinaryArithInstruction(kFastOpNone) {}
+
 	private:
 		MiniscriptInstructionOutcome arithExecute(MiniscriptThread *thread, double &result, double left, double right) const override;
 	};
 
 	class Modulo : public BinaryArithInstruction {
+	public:
+		Modulo() : BinaryArithInstruction(kFastOpNone) {}
+
 	private:
 		MiniscriptInstructionOutcome arithExecute(MiniscriptThread *thread, double &result, double left, double right) const override;
 	};
@@ -201,6 +262,9 @@ namespace MiniscriptInstructions {
 	};
 
 	class OrderedCompareInstruction : public MiniscriptInstruction{
+	public:
+		explicit OrderedCompareInstruction(FastOp fastOp) : MiniscriptInstruction(fastOp) {}
+
 	protected:
 		virtual bool compareFloat(double a, double b) const = 0;
 
@@ -209,6 +273,9 @@ namespace MiniscriptInstructions {
 	};
 
 	class UnorderedCompareInstruction : public MiniscriptInstruction {
+	public:
+		explicit UnorderedCompareInstruction(FastOp fastOp) : MiniscriptInstruction(fastOp) {}
+
 	protected:
 		virtual bool resolve(bool isEqual) const = 0;
 
@@ -217,31 +284,49 @@ namespace MiniscriptInstructions {
 	};
 
 	class CmpEqual : public UnorderedCompareInstruction {
+	public:
+		CmpEqual() : UnorderedCompareInstruction(kFastOpCmpEqual) {}
+
 	private:
 		bool resolve(bool isEqual) const override { return isEqual; };
 	};
 
 	class CmpNotEqual : public UnorderedCompareInstruction {
+	public:
+		CmpNotEqual() : UnorderedCompareInstruction(kFastOpCmpNotEqual) {}
+
 	private:
 		bool resolve(bool isEqual) const override { return !isEqual; };
 	};
 
 	class CmpLessOrEqual : public OrderedCompareInstruction {
+	public:
+		CmpLessOrEqual() : OrderedCompareInstruction(kFastOpCmpLessOrEqual) {}
+
 	private:
 		bool compareFloat(double a, double b) const override { return a <= b; }
 	};
 
 	class CmpLess : public OrderedCompareInstruction {
+	public:
+		CmpLess() : OrderedCompareInstruction(kFastOpCmpLess) {}
+
 	private:
 		bool compareFloat(double a, double b) const override { return a < b; }
 	};
 
 	class CmpGreaterOrEqual : public OrderedCompareInstruction {
+	public:
+		CmpGreaterOrEqual() : OrderedCompareInstruction(kFastOpCmpGreaterOrEqual) {}
+
 	private:
 		bool compareFloat(double a, double b) const override { return a >= b; }
 	};
 
 	class CmpGreater : public OrderedCompareInstruction {
+	public:
+		CmpGreater() : OrderedCompareInstruction(kFastOpCmpGreater) {}
+
 	private:
 		bool compareFloat(double a, double b) const override { return a > b; }
 	};
@@ -457,6 +542,7 @@ private:
 	};
 
 	MiniscriptInstructionOutcome runNextInstruction();
+	bool tryRunFastOp(MiniscriptInstruction::FastOp fastOp);
 
 	VThreadState resume(MiniscriptThread *thread);
 
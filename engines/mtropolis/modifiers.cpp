@@ -273,6 +273,19 @@ const char *MiniscriptModifier::getDefaultName() const {
 	return "Miniscript Modifier";
 }
 
+#ifdef MTROPOLIS_DEBUG_ENABLE
+void MiniscriptModifier::debugInspect(IDebugInspectionReport *report) const {
+	Modifier::debugInspect(report);
+
+	const MiniscriptProgram::ProfileStats &stats = _program->getProfileStats();
+	report->declareDynamic("instructions", Common::String::format("%u", static_cast<uint>(_program->getInstructions().size())));
+	report->declareDynamic("runs", Common::String::format("%u", stats.runs));
+	report->declareDynamic("failed runs", Common::String::format("%u", stats.failures));
+	report->declareDynamic("executed", Common::String::format("%llu", static_cast<unsigned long long>(stats.instructions)));
+	report->declareDynamic("fast path", Common::String::format("%llu", static_cast<unsigned long long>(stats.fastOps)));
+}
+#endif
+
 void MiniscriptModifier::linkInternalReferences(ObjectLinkingScope* scope) {
 	_references->linkInternalReferences(scope);
 }
@@ -301,6 +301,9 @@ Common::Error MTropolisEngine::run() {
 	if (ConfMan.getBool("mtropolis_pause_at_start")) {
 		_runtime->debugBreak();
 	}
+	if (ConfMan.hasKey("mtropolis_debug_validate_render") && ConfMan.getBool("mtropolis_debug_validate_render")) {
+		_runtime->setRenderValidationEnabled(true);
+	}
 #endif
 
 	// Done reading boot configuration
@@ -106,8 +106,23 @@ WindowParameters::WindowParameters(Runtime *wp_runtime, int32 wp_x, int32 wp_y,
 	: runtime(wp_runtime), x(wp_x), y(wp_y), width(wp_width), height(wp_height), format(wp_format) {
 }
 
+RenderedElementState::RenderedElementState() : layer(0), sceneStackDepth(0) {
+}
+
+RenderedElementState::RenderedElementState(const Common::Rect &rs_rect, uint16 rs_layer, size_t rs_sceneStackDepth)
+	: rect(rs_rect), layer(rs_layer), sceneStackDepth(rs_sceneStackDepth) {
+}
+
+bool RenderedElementState::operator==(const RenderedElementState &other) const {
+	return rect == other.rect && layer == other.layer && sceneStackDepth == other.sceneStackDepth;
+}
+
+bool RenderedElementState::operator!=(const RenderedElementState &other) const {
+	return !((*this) == other);
+}
+
 Window::Window(const WindowParameters &windowParams)
-	: _runtime(windowParams.runtime), _x(windowParams.x), _y(windowParams.y), _strata(0), _isMouseTransparent(false), _isMouseVisible(true) {
+	: _runtime(windowParams.runtime), _x(windowParams.x), _y(windowParams.y), _strata(0), _isMouseTransparent(false), _isMouseVisible(true), _renderedElementsValid(false) {
 	_surface.reset(new Graphics::ManagedSurface(windowParams.width, windowParams.height, windowParams.format));
 }
 
@@ -139,6 +154,9 @@ void Window::resizeWindow(int32 width, int32 height) {
 	Graphics::PixelFormat pixFmt = _surface->format;
 	_surface.reset();
 	_surface.reset(new Graphics::ManagedSurface(width, height, pixFmt));
+
+	_renderedElements.clear();
+	_renderedElementsValid = false;
 }
 
 const Common::SharedPtr<Graphics::ManagedSurface> &Window::getSurface() const {
@@ -149,6 +167,22 @@ const Graphics::PixelFormat& Window::getPixelFormat() const {
 	return _surface->format;
 }
 
+void Window::setSurface(const Common::SharedPtr<Graphics::ManagedSurface> &surface) {
+	_surface = surface;
+}
+
+RenderedElementMap_t &Window::getRenderedElements() {
+	return _renderedElements;
+}
+
+bool Window::hasValidRenderedElements() const {
+	return _renderedElementsValid;
+}
+
+void Window::setRenderedElementsValid(bool valid) {
+	_renderedElementsValid = valid;
+}
+
 const Common::SharedPtr<CursorGraphic> &Window::getCursorGraphic() const {
 	return _cursor;
 }
@@ -270,9 +304,93 @@ static void renderDirectElement(const RenderItem &item, Window *mainWindow) {
 	renderNormalElement(item, mainWindow);	// Meh
 }
 
-void renderProject(Runtime *runtime, Window *mainWindow, bool *outSkipped) {
-	bool sceneChanged = runtime->isSceneGraphDirty();
+static Common::Rect getRenderItemRect(const RenderItem &item) {
+	const Common::Point &origin = item.element->getCachedAbsoluteOrigin();
+	Common::Rect bounds = item.element->getRelativeRenderBounds();
+	bounds.translate(origin.x, origin.y);
+
+	return bounds;
+}
+
+static void addDirtyRect(Common::Array<Common::Rect> &dirtyRects, const Common::Rect &windowRect, const Common::Rect &rect) {
+	Common::Rect clippedRect = rect.findIntersectingRect(windowRect);
+	if (clippedRect.isEmpty())
+		return;
+
+	// Merge overlapping rects so that no pixel is drawn twice
+	for (;;) {
+		bool merged = false;
+		for (uint i = 0; i < dirtyRects.size(); i++) {
+			if (dirtyRects[i].intersects(clippedRect)) {
+				clippedRect.extend(dirtyRects[i]);
+				dirtyRects.remove_at(i);
+				merged = true;
+				break;
+			}
+		}
+
+		if (!merged)
+			break;
+	}
+
+	dirtyRects.push_back(clippedRect);
+}
+
+static void renderItemsInRect(const Common::Array<RenderItem> &items, Common::Array<bool> &rendered, size_t renderedOffset, const Common::Rect &rect, Window *mainWindow) {
+	for (size_t i = 0; i < items.size(); i++) {
+		const RenderItem &item = items[i];
+		if (!getRenderItemRect(item).intersects(rect))
+			continue;
+
+		// Elements draw at their absolute origin, so move it into the clipped surface
+		Common::Point origin = item.element->getCachedAbsoluteOrigin();
+		item.element->setCachedAbsoluteOrigin(Common::Point(origin.x - rect.left, origin.y - rect.top));
+		item.element->render(mainWindow);
+		item.element->setCachedAbsoluteOrigin(origin);
+
+		rendered[renderedOffset + i] = true;
+	}
+}
+
+static void validatePartialRender(const Common::Array<RenderItem> &normalBucket, const Common::Array<RenderItem> &directBucket, Window *mainWindow, const Common::SharedPtr<Graphics::ManagedSurface> &reference) {
+	Common::SharedPtr<Graphics::ManagedSurface> windowSurface = mainWindow->getSurface();
 
+	mainWindow->setSurface(reference);
+	for (const RenderItem &item : normalBucket)
+		item.element->render(mainWindow);
+	for (const RenderItem &item : directBucket)
+		item.element->render(mainWindow);
+	mainWindow->setSurface(windowSurface);
+
+	Common::Rect mismatchRect;
+	const uint rowSize = windowSurface->w * windowSurface->format.bytesPerPixel;
+	for (int y = 0; y < windowSurface->h; y++) {
+		const byte *row = static_cast<const byte *>(windowSurface->getBasePtr(0, y));
+		const byte *refRow = static_cast<const byte *>(reference->getBasePtr(0, y));
+
+		if (memcmp(row, refRow, rowSize) == 0)
+			continue;
+
+		for (int x = 0; x < windowSurface->w; x++) {
+			const uint pixelOffset = x * windowSurface->format.bytesPerPixel;
+			if (memcmp(row + pixelOffset, refRow + pixelOffset, windowSurface->format.bytesPerPixel) == 0)
+				continue;
+
+			Common::Rect pixelRect(x, y, x + 1, y + 1);
+			if (mismatchRect.isEmpty())
+				mismatchRect = pixelRect;
+			else
+				mismatchRect.extend(pixelRect);
+		}
+	}
+
+	if (!mismatchRect.isEmpty()) {
+		warning("Partial redraw differs from a full redraw in (%i, %i)-(%i, %i)", static_cast<int>(mismatchRect.left), static_cast<int>(mismatchRect.top), static_cast<int>(mismatchRect.right), static_cast<int>(mismatchRect.bottom));
+		windowSurface->copyFrom(*reference);
+	}
+}
+
+void renderProject(Runtime *runtime, Window *mainWindow, bool *outSkipped) {
 	Common::Array<Structural *> scenes;
 	runtime->getScenesInRenderOrder(scenes);
 
@@ -288,25 +406,53 @@ void renderProject(Runtime *runtime, Window *mainWindow, bool *outSkipped) {
 	Common::sort(normalBucket.begin(), normalBucket.end(), renderItemLess);
 	Common::sort(directBucket.begin(), directBucket.end(), renderItemLess);
 
-	if (!sceneChanged) {
-		for (Common::Array<RenderItem>::const_iterator it = normalBucket.begin(), itEnd = normalBucket.end(); it != itEnd; ++it) {
-			if (it->element->needsRender()) {
-				sceneChanged = true;
-				break;
+	// Diff the draw list against the previous frame: an element that changed, moved, appeared,
+	// disappeared or changed order dirties both the area it covered and the area it covers now.
+	const Common::Rect windowRect(mainWindow->getWidth(), mainWindow->getHeight());
+	RenderedElementMap_t &renderedElements = mainWindow->getRenderedElements();
+	RenderedElementMap_t newRenderedElements;
+	Common::Array<Common::Rect> dirtyRects;
+
+	for (int bucket = 0; bucket < 2; bucket++) {
+		const Common::Array<RenderItem> &items = (bucket == 0) ? normalBucket : directBucket;
+
+		for (const RenderItem &item : items) {
+			RenderedElementState state(getRenderItemRect(item), item.element->getLayer(), item.sceneStackDepth);
+			newRenderedElements[item.element] = state;
+
+			RenderedElementMap_t::iterator prevIt = renderedElements.find(item.element);
+			if (prevIt == renderedElements.end()) {
+				addDirtyRect(dirtyRects, windowRect, state.rect);
+			} else {
+				if (prevIt->_value != state || item.element->needsRender()) {
+					addDirtyRect(dirtyRects, windowRect, prevIt->_value.rect);
+					addDirtyRect(dirtyRects, windowRect, state.rect);
+				}
+				renderedElements.erase(prevIt);
 			}
 		}
 	}
 
-	if (!sceneChanged) {
-		for (Common::Array<RenderItem>::const_iterator it = directBucket.begin(), itEnd = directBucket.end(); it != itEnd; ++it) {
-			if (it->element->needsRender()) {
-				sceneChanged = true;
-				break;
-			}
-		}
+	for (const RenderedElementMap_t::Node &removed : renderedElements)
+		addDirtyRect(dirtyRects, windowRect, removed._value.rect);
+
+	bool fullRedraw = runtime->isFullRedrawRequested() || !mainWindow->hasValidRenderedElements() || runtime->getPostEffects().size() > 0;
+
+	if (!fullRedraw) {
+		// Past about half of the window, one full pass is cheaper than several clipped ones
+		uint32 dirtyArea = 0;
+		for (const Common::Rect &rect : dirtyRects)
+			dirtyArea += static_cast<uint32>(rect.width()) * static_cast<uint32>(rect.height());
+
+		if (dirtyArea * 2 > static_cast<uint32>(windowRect.width()) * static_cast<uint32>(windowRect.height()))
+			fullRedraw = true;
 	}
 
-	if (sceneChanged) {
+	renderedElements.clear();
+	renderedElements = newRenderedElements;
+	mainWindow->setRenderedElementsValid(true);
+
+	if (fullRedraw) {
 		if (outSkipped)
 			*outSkipped = false;
 
@@ -318,12 +464,57 @@ void renderProject(Runtime *runtime, Window *mainWindow, bool *outSkipped) {
 
 		for (const IPostEffect *postEffect : runtime->getPostEffects())
 			postEffect->renderPostEffect(*mainWindow->getSurface());
+	} else if (dirtyRects.size() > 0) {
+		if (outSkipped)
+			*outSkipped = false;
+
+		Common::SharedPtr<Graphics::ManagedSurface> windowSurface = mainWindow->getSurface();
+
+		Common::SharedPtr<Graphics::ManagedSurface> reference;
+		if (runtime->isRenderValidationEnabled()) {
+			reference.reset(new Graphics::ManagedSurface());
+			reference->copyFrom(*windowSurface);
+		}
+
+		Common::Array<bool> rendered;
+		rendered.resize(normalBucket.size() + directBucket.size());
+		for (uint i = 0; i < rendered.size(); i++)
+			rendered[i] = false;
+
+		for (const Common::Rect &rect : dirtyRects) {
+			Common::SharedPtr<Graphics::ManagedSurface> clippedSurface(new Graphics::ManagedSurface(*windowSurface, rect));
+
+			mainWindow->setSurface(clippedSurface);
+			renderItemsInRect(normalBucket, rendered, 0, rect, mainWindow);
+			renderItemsInRect(directBucket, rendered, normalBucket.size(), rect, mainWindow);
+		}
+
+		mainWindow->setSurface(windowSurface);
+
+		// Elements that changed entirely outside of the window still need their state updated
+		for (size_t i = 0; i < normalBucket.size(); i++) {
+			if (rendered[i])
+				normalBucket[i].element->finalizeRender();
+			else if (normalBucket[i].element->needsRender())
+				renderNormalElement(normalBucket[i], mainWindow);
+		}
+
+		for (size_t i = 0; i < directBucket.size(); i++) {
+			if (rendered[normalBucket.size() + i])
+				directBucket[i].element->finalizeRender();
+			else if (directBucket[i].element->needsRender())
+				renderDirectElement(directBucket[i], mainWindow);
+		}
+
+		if (reference)
+			validatePartialRender(normalBucket, directBucket, mainWindow, reference);
 	} else {
 		if (outSkipped)
 			*outSkipped = true;
 	}
 
 	runtime->clearSceneGraphDirty();
+	runtime->clearFullRedrawRequest();
 }
 
 class DissolveOrderedDitherPatternGenerator {
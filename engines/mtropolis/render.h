@@ -23,7 +23,10 @@
 #define MTROPOLIS_RENDER_H
 
 #include "common/events.h"
+#include "common/hashmap.h"
+#include "common/hash-ptr.h"
 #include "common/ptr.h"
+#include "common/rect.h"
 #include "common/scummsys.h"
 
 #include "graphics/pixelformat.h"
@@ -42,6 +45,7 @@ namespace MTropolis {
 class CursorGraphic;
 class Runtime;
 class Project;
+class VisualElement;
 struct SceneTransitionEffect;
 
 enum TextAlignment {
@@ -90,6 +94,21 @@ struct WindowParameters {
 	WindowParameters(Runtime *wp_runtime, int32 wp_x, int32 wp_y, int16 wp_width, int16 wp_height, const Graphics::PixelFormat &wp_format);
 };
 
+// State of an element as it was last drawn, used to find the areas that need redrawing
+struct RenderedElementState {
+	RenderedElementState();
+	RenderedElementState(const Common::Rect &rect, uint16 layer, size_t sceneStackDepth);
+
+	bool operator==(const RenderedElementState &other) const;
+	bool operator!=(const RenderedElementState &other) const;
+
+	Common::Rect rect;
+	uint16 layer;
+	size_t sceneStackDepth;
+};
+
+typedef Common::HashMap<const VisualElement *, RenderedElementState> RenderedElementMap_t;
+
 class Window {
 public:
 	explicit Window(const WindowParameters &windowParams);
@@ -105,6 +124,14 @@ public:
 	const Common::SharedPtr<Graphics::ManagedSurface> &getSurface() const;
 	const Graphics::PixelFormat &getPixelFormat() const;
 
+	// Replaces the render target, used to render into a clipped view of the window surface
+	void setSurface(const Common::SharedPtr<Graphics::ManagedSurface> &surface);
+
+	// Elements drawn into the window by the last project render, invalid until the first full redraw
+	RenderedElementMap_t &getRenderedElements();
+	bool hasValidRenderedElements() const;
+	void setRenderedElementsValid(bool valid);
+
 	const Common::SharedPtr<CursorGraphic> &getCursorGraphic() const;
 	void setCursorGraphic(const Common::SharedPtr<CursorGraphic> &cursor);
 
@@ -137,6 +164,9 @@ protected:
 
 	Common::SharedPtr<Graphics::ManagedSurface> _surface;
 	Common::SharedPtr<CursorGraphic> _cursor;
+
+	RenderedElementMap_t _renderedElements;
+	bool _renderedElementsValid;
 };
 
 namespace Render {
@@ -4549,7 +4549,7 @@ Runtime::Runtime(OSystem *system, Audio::Mixer *mixer, ISaveUIProvider *saveProv
 	  _displayWidth(1024), _displayHeight(768), _realTime(0), _realTimeBase(0), _playTime(0), _playTimeBase(0), _sceneTransitionState(kSceneTransitionStateNotTransitioning),
 	  _lastFrameCursor(nullptr), _lastFrameMouseVisible(false), _defaultCursor(new DefaultCursorGraphic()),
 	  _cachedMousePosition(Common::Point(0, 0)), _realMousePosition(Common::Point(0, 0)), _trackedMouseOutside(false),
-	  _forceCursorRefreshOnce(true), _autoResetCursor(false), _haveModifierOverrideCursor(false), _haveCursorElement(false), _sceneGraphChanged(false), _isQuitting(false),
+	  _forceCursorRefreshOnce(true), _autoResetCursor(false), _haveModifierOverrideCursor(false), _haveCursorElement(false), _sceneGraphChanged(false), _fullRedrawRequested(true), _renderValidationEnabled(false), _isQuitting(false),
 	  _collisionCheckTime(0), /*_elementCursorUpdateTime(0), */_defaultVolumeState(true), _activeSceneTransitionEffect(nullptr), _sceneTransitionStartTime(0), _sceneTransitionEndTime(0),
 	  _sharedSceneWasSetExplicitly(false), _modifierOverrideCursorID(0), _subtitleRenderer(subRenderer), _multiClickStartTime(0), _multiClickInterval(500), _multiClickCount(0), _numMouseBlockers(0),
 	  _pendingSceneReturnCount(0) {
@@ -4817,6 +4817,7 @@ bool Runtime::runFrame() {
 			}
 			_pendingTeardowns.clear();
 			_sceneGraphChanged = true;
+			_fullRedrawRequested = true;
 			continue;
 		}
 
@@ -4860,6 +4861,7 @@ bool Runtime::runFrame() {
 
 			executeHighLevelSceneReturn();
 			_sceneGraphChanged = true;
+			_fullRedrawRequested = true;
 			continue;
 		}
 
@@ -4869,6 +4871,7 @@ bool Runtime::runFrame() {
 
 			executeHighLevelSceneTransition(transition);
 			_sceneGraphChanged = true;
+			_fullRedrawRequested = true;
 			continue;
 		}
 
@@ -5001,8 +5004,11 @@ void Runtime::drawFrame() {
 	_system->fillScreen(Render::resolveRGB(0, 0, 0, getRenderPixelFormat()));
 
 	bool needToRenderSubtitles = false;
-	if (_subtitleRenderer && _subtitleRenderer->update(_playTime))
+	if (_subtitleRenderer && _subtitleRenderer->update(_playTime)) {
+		// Subtitles are drawn over the window contents, removing them needs the whole frame
 		setSceneGraphDirty();
+		requestFullRedraw();
+	}
 
 	{
 		Common::SharedPtr<Window> mainWindow = _mainWindow.lock();
@@ -6801,6 +6807,26 @@ bool Runtime::isSceneGraphDirty() const {
 	return _sceneGraphChanged;
 }
 
+void Runtime::requestFullRedraw() {
+	_fullRedrawRequested = true;
+}
+
+void Runtime::clearFullRedrawRequest() {
+	_fullRedrawRequested = false;
+}
+
+bool Runtime::isFullRedrawRequested() const {
+	return _fullRedrawRequested;
+}
+
+void Runtime::setRenderValidationEnabled(bool enabled) {
+	_renderValidationEnabled = enabled;
+}
+
+bool Runtime::isRenderValidationEnabled() const {
+	return _renderValidationEnabled;
+}
+
 void Runtime::addCollider(ICollider *collider) {
 	Common::SharedPtr<CollisionCheckState> state(new CollisionCheckState());
 	state->collider = collider;
@@ -7007,6 +7033,7 @@ void Runtime::removePostEffect(IPostEffect *postEffect) {
 	for (size_t i = 0; i < numPostEffects; i++) {
 		if (_postEffects[i] == postEffect) {
 			_postEffects.remove_at(i);
+			_fullRedrawRequested = true;
 			return;
 		}
 	}
@@ -7023,8 +7050,10 @@ const Palette &Runtime::getGlobalPalette() const {
 void Runtime::setGlobalPalette(const Palette &palette) {
 	if (_realDisplayMode <= kColorDepthMode8Bit)
 		g_system->getPaletteManager()->setPalette(palette.getPalette(), 0, 256);
-	else
+	else {
 		setSceneGraphDirty();
+		requestFullRedraw();
+	}
 
 	_globalPalette = palette;
 }
@@ -9397,6 +9426,9 @@ VThreadState VisualElement::offsetTranslateTask(const OffsetTranslateTaskData &d
 }
 
 void VisualElement::setTransitionProperties(const VisualElementTransitionProperties &props) {
+	if (_transitionProps.getAlpha() != props.getAlpha())
+		_contentsDirty = true;
+
 	_transitionProps = props;
 }
 
@@ -9435,6 +9467,10 @@ bool VisualElement::needsRender() const {
 	return false;
 }
 
+Common::Rect VisualElement::getRelativeRenderBounds() const {
+	return Common::Rect(_rect.width(), _rect.height());
+}
+
 void VisualElement::finalizeRender() {
 	_renderProps.clearDirty();
 	_prevRect = _rect;
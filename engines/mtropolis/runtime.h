@@ -1686,6 +1686,15 @@ public:
 	void clearSceneGraphDirty();
 	bool isSceneGraphDirty() const;
 
+	// Requests a redraw of the whole main window on the next frame, for changes that aren't tracked per element
+	void requestFullRedraw();
+	void clearFullRedrawRequest();
+	bool isFullRedrawRequested() const;
+
+	// Checks each partially redrawn frame against a full redraw
+	void setRenderValidationEnabled(bool enabled);
+	bool isRenderValidationEnabled() const;
+
 	void addCollider(ICollider *collider);
 	void removeCollider(ICollider *collider);
 	void checkCollisions(ICollider *optRestrictToCollider);
@@ -2006,6 +2015,8 @@ private:
 
 	// True if any elements were added to the scene, removed from the scene, or reparented since last draw
 	bool _sceneGraphChanged;
+	bool _fullRedrawRequested;
+	bool _renderValidationEnabled;
 
 	bool _isQuitting;
 
@@ -2898,6 +2909,9 @@ public:
 	virtual void render(Window *window) = 0;
 	void finalizeRender();
 
+	// Area touched by render(), relative to the element origin.  Used for partial redraws.
+	virtual Common::Rect getRelativeRenderBounds() const;
+
 	void setPalette(const Common::SharedPtr<Palette> &palette);
 	const Common::SharedPtr<Palette> &getPalette() const;
 
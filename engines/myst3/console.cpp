@@ -25,6 +25,7 @@
 #include "engines/myst3/database.h"
 #include "engines/myst3/effects.h"
 #include "engines/myst3/inventory.h"
+#include "engines/myst3/nodecube.h"
 #include "engines/myst3/script.h"
 #include "engines/myst3/state.h"
 
@@ -43,6 +44,7 @@ Console::Console(Myst3Engine *vm) : GUI::Debugger(), _vm(vm) {
 	registerCmd("fillInventory",			WRAP_METHOD(Console, Cmd_FillInventory));
 	registerCmd("dumpArchive",			WRAP_METHOD(Console, Cmd_DumpArchive));
 	registerCmd("dumpMasks",			WRAP_METHOD(Console, Cmd_DumpMasks));
+	registerCmd("prefetch",				WRAP_METHOD(Console, Cmd_Prefetch));
 }
 
 Console::~Console() {
@@ -326,6 +328,26 @@ bool Console::Cmd_FillInventory(int argc, const char **argv) {
 	return false;
 }
 
+bool Console::Cmd_Prefetch(int argc, const char **argv) {
+	CubeFacePrefetcher *prefetcher = _vm->_cubeFacePrefetcher;
+
+	if (argc == 2 && !strcmp(argv[1], "reset")) {
+		prefetcher->resetStats();
+	} else if (argc != 1) {
+		debugPrintf("Usage :\n");
+		debugPrintf("prefetch [reset]\n");
+		return true;
+	}
+
+	uint32 lookups = prefetcher->getHits() + prefetcher->getMisses();
+	debugPrintf("Cube face prefetch hits: %d, misses: %d (%d%% hit rate)\n",
+			prefetcher->getHits(), prefetcher->getMisses(),
+			lookups ? prefetcher->getHits() * 100 / lookups : 0);
+	debugPrintf("Faces cached: %d, pending: %d\n", prefetcher->getCachedCount(), prefetcher->getPendingCount());
+
+	return true;
+}
+
 class DumpingArchiveVisitor : public ArchiveVisitor {
 public:
 	DumpingArchiveVisitor() :
@@ -67,7 +67,7 @@ Myst3Engine::Myst3Engine(OSystem *syst, const Myst3GameDescription *version) :
 		_db(nullptr), _scriptEngine(nullptr),
 		_state(nullptr), _node(nullptr), _scene(nullptr), _archiveNode(nullptr),
 		_cursor(nullptr), _inventory(nullptr), _gfx(nullptr), _menu(nullptr),
-		_rnd(nullptr), _sound(nullptr), _ambient(nullptr),
+		_rnd(nullptr), _sound(nullptr), _ambient(nullptr), _cubeFacePrefetcher(nullptr),
 		_inputSpacePressed(false), _inputEnterPressed(false),
 		_inputEscapePressed(false), _inputTildePressed(false),
 		_inputEscapePressedNotConsumed(false),
@@ -114,6 +114,7 @@ Myst3Engine::~Myst3Engine() {
 	delete _cursor;
 	delete _scene;
 	delete _archiveNode;
+	delete _cubeFacePrefetcher;
 	delete _db;
 	delete _scriptEngine;
 	delete _state;
@@ -172,6 +173,7 @@ Common::Error Myst3Engine::run() {
 	_db = new Database(getPlatform(), lang, getGameLocalizationType());
 	_state = new GameState(getPlatform(), _db);
 	_scene = new Scene(this);
+	_cubeFacePrefetcher = new CubeFacePrefetcher(this);
 	if (getPlatform() == Common::kPlatformXbox) {
 		_menu = new AlbumMenu(this);
 	} else {
@@ -220,6 +222,9 @@ Common::Error Myst3Engine::run() {
 			_menuAction = 0;
 		}
 
+		// Use the idle time of the main loop to get the next nodes ready
+		_cubeFacePrefetcher->decodeNext();
+
 		drawFrame();
 	}
 
@@ -929,6 +934,34 @@ void Myst3Engine::loadNode(uint16 nodeID, uint32 roomID, uint32 ageID) {
 	// Releeshan to the player when he is trapped between both shields.
 	if (nodeID == 9 && roomID == kRoomNarayan)
 		_state->setVar(39, 0);
+
+	prefetchNeighbourNodes();
+}
+
+void Myst3Engine::prefetchNeighbourNodes() {
+	uint16 nodeID = _state->getLocationNode();
+	uint32 roomID = _state->getLocationRoom();
+	uint32 ageID = _state->getLocationAge();
+	Common::Array<uint16> neighbours;
+
+	// Only the cube nodes have a fixed set of exits the player can take by clicking around
+	if (_state->getViewType() == kCube) {
+		NodePtr nodeData = _db->getNodeData(nodeID, roomID, ageID);
+		if (nodeData) {
+			for (uint i = 0; i < nodeData->hotspots.size(); i++) {
+				_scriptEngine->listNodeDestinations(nodeData->hotspots[i].script, neighbours);
+			}
+		}
+	}
+
+	for (uint i = 0; i < neighbours.size(); i++) {
+		if (neighbours[i] == nodeID) {
+			neighbours.remove_at(i);
+			break;
+		}
+	}
+
+	_cubeFacePrefetcher->setNeighbours(roomID, ageID, neighbours);
 }
 
 void Myst3Engine::unloadNode() {
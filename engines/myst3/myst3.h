@@ -71,6 +71,7 @@ class Script;
 class SpotItemFace;
 class SunSpot;
 class Renderer;
+class CubeFacePrefetcher;
 class Menu;
 class Node;
 class Sound;
@@ -102,6 +103,7 @@ public:
 	Database *_db;
 	Sound *_sound;
 	Ambient *_ambient;
+	CubeFacePrefetcher *_cubeFacePrefetcher;
 
 	Common::RandomSource *_rnd;
 
@@ -235,6 +237,7 @@ private:
 	bool _inventoryManualHide;
 
 	HotSpot *getHoveredHotspot(NodePtr nodeData, uint16 var = 0);
+	void prefetchNeighbourNodes();
 	void updateCursor();
 
 	bool checkDatafiles();
@@ -22,22 +22,35 @@
 #include "engines/myst3/archive.h"
 #include "engines/myst3/nodecube.h"
 #include "engines/myst3/myst3.h"
+#include "engines/myst3/state.h"
 
 #include "common/debug.h"
 
+#include "graphics/surface.h"
+
 namespace Myst3 {
 
 NodeCube::NodeCube(Myst3Engine *vm, uint16 id) :
 		Node(vm, id) {
 	_is3D = true;
 
+	uint32 roomID = _vm->_state->getLocationRoom();
+	uint32 ageID = _vm->_state->getLocationAge();
+
 	for (int i = 0; i < 6; i++) {
+		_faces[i] = new Face(_vm, true);
+
+		Graphics::Surface *bitmap = _vm->_cubeFacePrefetcher->takeFace(roomID, ageID, id, i + 1);
+		if (bitmap) {
+			_faces[i]->setTextureFromBitmap(bitmap);
+			continue;
+		}
+
 		ResourceDescription jpegDesc = _vm->getFileDescription("", id, i + 1, Archive::kCubeFace);
 
 		if (!jpegDesc.isValid())
 			error("Face %d does not exist", id);
 
-		_faces[i] = new Face(_vm, true);
 		_faces[i]->setTextureFromJPEG(&jpegDesc);
 	}
 }
@@ -65,4 +78,106 @@ bool NodeCube::isFaceVisible(uint faceId) {
 	return _vm->_gfx->isCubeFaceVisible(faceId);
 }
 
+CubeFacePrefetcher::CubeFacePrefetcher(Myst3Engine *vm) :
+		_vm(vm),
+		_hits(0),
+		_misses(0) {
+}
+
+CubeFacePrefetcher::~CubeFacePrefetcher() {
+	clear();
+}
+
+void CubeFacePrefetcher::setNeighbours(uint32 roomID, uint32 ageID, const Common::Array<uint16> &nodes) {
+	_pending.clear();
+
+	for (uint i = 0; i < nodes.size(); i++) {
+		for (uint16 face = 1; face <= 6; face++) {
+			// Don't queue more faces than the cache can hold, they would evict each other
+			if (_pending.size() >= kMaxCachedFaces)
+				return;
+
+			if (findCached(roomID, ageID, nodes[i], face) >= 0)
+				continue;
+
+			Entry entry;
+			entry.roomID = roomID;
+			entry.ageID = ageID;
+			entry.nodeID = nodes[i];
+			entry.face = face;
+			entry.bitmap = nullptr;
+			_pending.push_back(entry);
+		}
+	}
+}
+
+bool CubeFacePrefetcher::decodeNext() {
+	while (!_pending.empty()) {
+		Entry entry = _pending.front();
+		_pending.remove_at(0);
+
+		// Resources can only be found in the archive of the current room
+		if (entry.roomID != (uint32)_vm->_state->getLocationRoom() || entry.ageID != (uint32)_vm->_state->getLocationAge())
+			continue;
+
+		ResourceDescription jpegDesc = _vm->getFileDescription("", entry.nodeID, entry.face, Archive::kCubeFace);
+		if (!jpegDesc.isValid())
+			continue; // Not a cube node
+
+		entry.bitmap = Myst3Engine::decodeJpeg(&jpegDesc);
+
+		if (_cache.size() >= kMaxCachedFaces) {
+			freeBitmap(_cache.front().bitmap);
+			_cache.remove_at(0);
+		}
+		_cache.push_back(entry);
+
+		debugC(kDebugNode, "Prefetched face %d of node %d", entry.face, entry.nodeID);
+		return true;
+	}
+
+	return false;
+}
+
+Graphics::Surface *CubeFacePrefetcher::takeFace(uint32 roomID, uint32 ageID, uint16 nodeID, uint16 face) {
+	int index = findCached(roomID, ageID, nodeID, face);
+	if (index < 0) {
+		_misses++;
+		return nullptr;
+	}
+
+	_hits++;
+
+	Graphics::Surface *bitmap = _cache[index].bitmap;
+	_cache.remove_at(index);
+	return bitmap;
+}
+
+void CubeFacePrefetcher::clear() {
+	for (uint i = 0; i < _cache.size(); i++) {
+		freeBitmap(_cache[i].bitmap);
+	}
+	_cache.clear();
+	_pending.clear();
+}
+
+void CubeFacePrefetcher::resetStats() {
+	_hits = 0;
+	_misses = 0;
+}
+
+int CubeFacePrefetcher::findCached(uint32 roomID, uint32 ageID, uint16 nodeID, uint16 face) const {
+	for (uint i = 0; i < _cache.size(); i++) {
+		if (_cache[i].matches(roomID, ageID, nodeID, face))
+			return i;
+	}
+
+	return -1;
+}
+
+void CubeFacePrefetcher::freeBitmap(Graphics::Surface *bitmap) {
+	bitmap->free();
+	delete bitmap;
+}
+
 } // End of namespace Myst3
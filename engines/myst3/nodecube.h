@@ -26,6 +26,73 @@
 
 namespace Myst3 {
 
+/**
+ * Decodes ahead of time the cube faces of the nodes the player can move to
+ *
+ * The faces are decoded one at a time from the main loop and kept in a
+ * bounded cache, so that moving to a neighbour node does not have to wait
+ * for the JPEG decoder before the transition can start.
+ */
+class CubeFacePrefetcher {
+public:
+	CubeFacePrefetcher(Myst3Engine *vm);
+	~CubeFacePrefetcher();
+
+	/**
+	 * Replaces the list of nodes to prefetch, in order of priority
+	 */
+	void setNeighbours(uint32 roomID, uint32 ageID, const Common::Array<uint16> &nodes);
+
+	/**
+	 * Decodes the next pending face
+	 *
+	 * @return false when there is nothing left to decode
+	 */
+	bool decodeNext();
+
+	/**
+	 * Removes a face from the cache, giving the ownership of its bitmap to the caller
+	 *
+	 * @return the decoded bitmap, or nullptr when the face was not prefetched
+	 */
+	Graphics::Surface *takeFace(uint32 roomID, uint32 ageID, uint16 nodeID, uint16 face);
+
+	/** Frees all the prefetched faces */
+	void clear();
+
+	uint32 getHits() const { return _hits; }
+	uint32 getMisses() const { return _misses; }
+	uint32 getCachedCount() const { return _cache.size(); }
+	uint32 getPendingCount() const { return _pending.size(); }
+	void resetStats();
+
+private:
+	static const uint kMaxCachedFaces = 24;
+
+	struct Entry {
+		uint32 roomID;
+		uint32 ageID;
+		uint16 nodeID;
+		uint16 face;
+		Graphics::Surface *bitmap;
+
+		bool matches(uint32 room, uint32 age, uint16 node, uint16 f) const {
+			return roomID == room && ageID == age && nodeID == node && face == f;
+		}
+	};
+
+	Myst3Engine *_vm;
+
+	Common::Array<Entry> _cache;   // Oldest first
+	Common::Array<Entry> _pending; // Faces waiting to be decoded, highest priority first
+
+	uint32 _hits;
+	uint32 _misses;
+
+	int findCached(uint32 roomID, uint32 ageID, uint16 nodeID, uint16 face) const;
+	static void freeBitmap(Graphics::Surface *bitmap);
+};
+
 class NodeCube: public Node {
 public:
 	NodeCube(Myst3Engine *vm, uint16 id);
@@ -333,6 +333,33 @@ const Script::Command &Script::findCommandByProc(CommandProc proc) {
 	return findCommand(0);
 }
 
+void Script::listNodeDestinations(const Common::Array<Opcode> &script, Common::Array<uint16> &nodes) {
+	for (uint i = 0; i < script.size(); i++) {
+		const Opcode &opcode = script[i];
+		CommandProc proc = findCommand(opcode.op).proc;
+
+		if (proc != &Script::goToNodeTransition && proc != &Script::goToNodeTrans1
+				&& proc != &Script::goToNodeTrans2 && proc != &Script::zipToNode)
+			continue;
+
+		// Destinations read from variables can't be predicted
+		if (opcode.args.empty() || opcode.args[0] <= 0)
+			continue;
+
+		uint16 node = opcode.args[0];
+		bool found = false;
+		for (uint j = 0; j < nodes.size(); j++) {
+			if (nodes[j] == node) {
+				found = true;
+				break;
+			}
+		}
+
+		if (!found)
+			nodes.push_back(node);
+	}
+}
+
 void Script::shiftCommands(uint16 base, int32 value) {
 	for (uint16 i = 0; i < _commands.size(); i++)
 		if (_commands[i].op >= base)
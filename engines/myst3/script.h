@@ -42,6 +42,11 @@ public:
 
 	const Common::String describeOpcode(const Opcode &opcode);
 
+	/**
+	 * Appends to a list the nodes of the current room a script can move the player to
+	 */
+	void listNodeDestinations(const Common::Array<Opcode> &script, Common::Array<uint16> &nodes);
+
 private:
 	struct Context {
 		bool endScript;
@@ -24,6 +24,8 @@
 #include "engines/metaengine.h"
 #include "graphics/surface.h"
 #include "common/config-manager.h"
+#include "common/savefile.h"
+#include "common/system.h"
 #include "common/textconsole.h"
 #include "common/translation.h"
 
@@ -64,7 +66,21 @@ void SaveStateDescriptor::initSaveSlot(const MetaEngine *metaEngine) {
 	}
 }
 
+const Graphics::Surface *SaveStateDescriptor::getThumbnail() const {
+	if (!_thumbnailFile.empty()) {
+		Common::ScopedPtr<Common::InSaveFile> f(g_system->getSavefileManager()->openForLoading(_thumbnailFile));
+		_thumbnailFile.clear();
+
+		ExtendedSavegameHeader header;
+		if (f && MetaEngine::readSavegameHeader(f.get(), &header, false) && header.thumbnail)
+			_thumbnail = Common::SharedPtr<Graphics::Surface>(header.thumbnail, Graphics::SurfaceDeleter());
+	}
+
+	return _thumbnail.get();
+}
+
 void SaveStateDescriptor::setThumbnail(Graphics::Surface *t) {
+	_thumbnailFile.clear();
 	if (_thumbnail.get() == t)
 		return;
 
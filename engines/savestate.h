@@ -135,7 +135,7 @@ public:
 	 * should be either 160x100 or 160x120 pixels, depending on the aspect
 	 * ratio of the game. If another ratio is required, contact the core team.
 	 */
-	const Graphics::Surface *getThumbnail() const { return _thumbnail.get(); }
+	const Graphics::Surface *getThumbnail() const;
 
 	/**
 	 * Set a thumbnail graphics surface representing the savestate visually.
@@ -143,7 +143,13 @@ public:
 	 * Hence the caller must not delete the surface.
 	 */
 	void setThumbnail(Graphics::Surface *t);
-	void setThumbnail(Common::SharedPtr<Graphics::Surface> t) { _thumbnail = t; }
+	void setThumbnail(Common::SharedPtr<Graphics::Surface> t) { _thumbnail = t; _thumbnailFile.clear(); }
+
+	/**
+	 * Load the thumbnail from the extended header of the given save file
+	 * the first time it is requested, instead of setting it right away.
+	 */
+	void setThumbnailFile(const Common::String &filename) { _thumbnail.reset(); _thumbnailFile = filename; }
 
 	/**
 	 * Sets the date the save state was created.
@@ -277,7 +283,12 @@ private:
 	/**
 	 * The thumbnail of the save state.
 	 */
-	Common::SharedPtr<Graphics::Surface> _thumbnail;
+	mutable Common::SharedPtr<Graphics::Surface> _thumbnail;
+
+	/**
+	 * Save file to load the thumbnail from when it is first requested.
+	 */
+	mutable Common::String _thumbnailFile;
 
 	/**
 	 * Save file type
@@ -21,14 +21,44 @@
 
 #include "sword25/console.h"
 #include "sword25/sword25.h"
+#include "sword25/kernel/kernel.h"
+#include "sword25/script/script.h"
+
+#include "common/lua/lua_arena.h"
 
 namespace Sword25 {
 
 Sword25Console::Sword25Console(Sword25Engine *vm) : GUI::Debugger(), _vm(vm) {
 	assert(_vm);
+
+	registerCmd("lua_mem", WRAP_METHOD(Sword25Console, Cmd_LuaMem));
 }
 
 Sword25Console::~Sword25Console() {
 }
 
+bool Sword25Console::Cmd_LuaMem(int argc, const char **argv) {
+	ScriptEngine *script = Kernel::getInstance()->getScript();
+	lua_State *L = script ? static_cast<lua_State *>(script->getScriptObject()) : nullptr;
+
+	Lua::ArenaStats stats;
+	if (!L || !Lua::getArenaStats(L, stats)) {
+		debugPrintf("The Lua state does not use the arena allocator\n");
+		return true;
+	}
+
+	debugPrintf("In use: %u bytes (peak %u), large blocks %u bytes\n",
+		(uint)stats.bytesInUse, (uint)stats.peakBytesInUse, (uint)stats.largeBytesInUse);
+	debugPrintf("Chunks: %u bytes\n", (uint)stats.chunkBytes);
+	debugPrintf("Allocations: %u, frees: %u, in place reallocations: %u, large allocations: %u\n",
+		stats.allocCount, stats.freeCount, stats.reallocInPlace, stats.largeAllocCount);
+
+	for (uint i = 0; i < Lua::kArenaSizeClasses; i++) {
+		if (stats.classBlocks[i])
+			debugPrintf("  %3u bytes: %u blocks\n", (i + 1) * Lua::kArenaGranularity, stats.classBlocks[i]);
+	}
+
+	return true;
+}
+
 } // End of namespace Sword25
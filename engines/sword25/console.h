@@ -34,6 +34,8 @@ public:
 	~Sword25Console(void) override;
 
 private:
+	bool Cmd_LuaMem(int argc, const char **argv);
+
 	Sword25Engine *_vm;
 };
 
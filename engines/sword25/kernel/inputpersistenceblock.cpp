@@ -28,6 +28,7 @@
  *
  */
 
+#include "common/memstream.h"
 #include "common/textconsole.h"
 
 #include "sword25/kernel/inputpersistenceblock.h"
@@ -117,6 +118,21 @@ void InputPersistenceBlock::readByteArray(Common::Array<byte> &value) {
 	}
 }
 
+Common::SeekableReadStream *InputPersistenceBlock::readByteArrayStream() {
+	if (checkMarker(BLOCK_MARKER)) {
+		uint32 size;
+		read(size);
+
+		if (checkBlockSize(size)) {
+			Common::SeekableReadStream *stream = new Common::MemoryReadStream(&*_iter, size, DisposeAfterUse::NO);
+			_iter += size;
+			return stream;
+		}
+	}
+
+	return nullptr;
+}
+
 bool InputPersistenceBlock::checkBlockSize(int size) {
 	if (_data.end() - _iter >= size) {
 		return true;
@@ -32,6 +32,7 @@
 #define SWORD25_INPUTPERSISTENCEBLOCK_H
 
 #include "common/array.h"
+#include "common/stream.h"
 #include "sword25/kernel/common.h"
 #include "sword25/kernel/persistenceblock.h"
 
@@ -56,6 +57,13 @@ public:
 	void readString(Common::String &value);
 	void readByteArray(Common::Array<byte> &value);
 
+	/**
+	 * Reads a data block written by writeByteArray() or through a PersistenceBlockWriteStream,
+	 * returning a stream over the data in place instead of copying it. The stream must not
+	 * outlive the persistence block. Returns nullptr if the block couldn't be read.
+	 */
+	Common::SeekableReadStream *readByteArrayStream();
+
 	bool isGood() const {
 		return _errorState == NONE;
 	}
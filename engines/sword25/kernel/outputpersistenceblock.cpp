@@ -28,6 +28,7 @@
  *
  */
 
+#include "common/algorithm.h"
 #include "sword25/kernel/outputpersistenceblock.h"
 
 namespace {
@@ -91,6 +92,22 @@ void OutputPersistenceBlock::writeByteArray(Common::Array<byte> &value) {
 	rawWrite(&value[0], value.size());
 }
 
+uint OutputPersistenceBlock::beginBlock() {
+	writeMarker(BLOCK_MARKER);
+	writeMarker(UINT_MARKER);
+
+	// The size is filled in by endBlock()
+	uint start = _data.size();
+	uint32 size = 0;
+	rawWrite(&size, sizeof(size));
+	return start;
+}
+
+void OutputPersistenceBlock::endBlock(uint start) {
+	assert(start + sizeof(uint32) <= _data.size());
+	WRITE_LE_UINT32(&_data[start], _data.size() - start - sizeof(uint32));
+}
+
 void OutputPersistenceBlock::writeMarker(byte marker) {
 	_data.push_back(marker);
 }
@@ -98,6 +115,10 @@ void OutputPersistenceBlock::writeMarker(byte marker) {
 void OutputPersistenceBlock::rawWrite(const void *dataPtr, size_t size) {
 	if (size > 0) {
 		uint oldSize = _data.size();
+
+		// Grow the buffer in powers of two, since resize() only allocates
+		// exactly what's asked for
+		_data.reserve(Common::nextHigher2<uint>(oldSize + size));
 		_data.resize(oldSize + size);
 		memcpy(&_data[oldSize], dataPtr, size);
 	}
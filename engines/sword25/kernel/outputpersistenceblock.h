@@ -31,6 +31,7 @@
 #ifndef SWORD25_OUTPUTPERSISTENCEBLOCK_H
 #define SWORD25_OUTPUTPERSISTENCEBLOCK_H
 
+#include "common/stream.h"
 #include "sword25/kernel/common.h"
 #include "sword25/kernel/persistenceblock.h"
 
@@ -48,6 +49,16 @@ public:
 	void writeString(const Common::String &string);
 	void writeByteArray(Common::Array<byte> &value);
 
+	/**
+	 * Starts a data block whose size isn't known yet. The data is appended with writeBlockData(),
+	 * and endBlock() is then called with the returned position to fill in the size.
+	 */
+	uint beginBlock();
+	void writeBlockData(const void *data, uint32 size) {
+		rawWrite(data, size);
+	}
+	void endBlock(uint start);
+
 	const void *getData() const {
 		return &_data[0];
 	}
@@ -62,6 +73,43 @@ private:
 	Common::Array<byte> _data;
 };
 
+/**
+ * Stream that writes straight into a data block of an output persistence block. This avoids
+ * assembling large data, such as the Lua state, in a separate buffer before storing it.
+ * The block is completed when the stream is finalized or destroyed.
+ */
+class PersistenceBlockWriteStream : public Common::WriteStream {
+public:
+	PersistenceBlockWriteStream(OutputPersistenceBlock &block) : _block(block), _size(0), _finished(false) {
+		_start = _block.beginBlock();
+	}
+	~PersistenceBlockWriteStream() override {
+		finalize();
+	}
+
+	uint32 write(const void *dataPtr, uint32 dataSize) override {
+		assert(!_finished);
+		_block.writeBlockData(dataPtr, dataSize);
+		_size += dataSize;
+		return dataSize;
+	}
+	int64 pos() const override {
+		return _size;
+	}
+	void finalize() override {
+		if (!_finished) {
+			_block.endBlock(_start);
+			_finished = true;
+		}
+	}
+
+private:
+	OutputPersistenceBlock &_block;
+	uint _start;
+	uint32 _size;
+	bool _finished;
+};
+
 } // End of namespace Sword25
 
 #endif
@@ -42,6 +42,7 @@
 #include "common/lua/lua.h"
 #include "common/lua/lualib.h"
 #include "common/lua/lauxlib.h"
+#include "common/lua/lua_arena.h"
 #include "common/lua/lua_persistence.h"
 
 namespace Sword25 {
@@ -55,7 +56,7 @@ LuaScriptEngine::LuaScriptEngine(Kernel *KernelPtr) :
 LuaScriptEngine::~LuaScriptEngine() {
 	// Lua de-initialisation
 	if (_state)
-		lua_close(_state);
+		Lua::closeArenaState(_state);
 }
 
 namespace {
@@ -74,8 +75,10 @@ void debugHook(lua_State *L, lua_Debug *ar) {
 
 bool LuaScriptEngine::init() {
 	// Lua-State initialisation, as well as standard libaries initialisation
-	_state = luaL_newstate();
-	if (!_state || ! registerStandardLibs() || !registerStandardLibExtensions()) {
+	// Scripts churn through many small tables and strings, so these come from
+	// per-state size class arenas instead of the system allocator
+	_state = Lua::newArenaState();
+	if (!_state) {
 		error("Lua could not be initialized.");
 		return false;
 	}
@@ -83,6 +86,11 @@ bool LuaScriptEngine::init() {
 	// Register panic callback function
 	lua_atpanic(_state, panicCB);
 
+	if (!registerStandardLibs() || !registerStandardLibExtensions()) {
+		error("Lua could not be initialized.");
+		return false;
+	}
+
 	// Error handler for lua_pcall calls
 	// The code below contains a local error handler function
 	const char errorHandlerCode[] =
@@ -393,12 +401,10 @@ bool LuaScriptEngine::persist(OutputPersistenceBlock &writer) {
 	pushPermanentsTable(_state, PTT_PERSIST);
 	lua_getglobal(_state, "_G");
 
-	// Lua persists and stores the data in a WriteStream
-	Common::MemoryWriteStreamDynamic writeStream(DisposeAfterUse::YES);
+	// Lua persists its data straight into the writer, as a single data block
+	PersistenceBlockWriteStream writeStream(writer);
 	Lua::persistLua(_state, &writeStream);
-
-	// Persistenzdaten in den Writer schreiben.
-	writer.write(writeStream.getData(), writeStream.size());
+	writeStream.finalize();
 
 	// Die beiden Tabellen vom Stack nehmen.
 	lua_pop(_state, 2);
@@ -476,12 +482,15 @@ bool LuaScriptEngine::unpersist(InputPersistenceBlock &reader) {
 	};
 	clearGlobalTable(_state, clearExceptionsSecondPass);
 
-	// Persisted Lua data
-	Common::Array<byte> chunkData;
-	reader.readByteArray(chunkData);
-	Common::MemoryReadStream readStream(&chunkData[0], chunkData.size(), DisposeAfterUse::NO);
+	// Persisted Lua data, read in place from the reader
+	Common::SeekableReadStream *readStream = reader.readByteArrayStream();
+	if (!readStream) {
+		lua_pop(_state, 1);
+		return false;
+	}
 
-	Lua::unpersistLua(_state, &readStream);
+	Lua::unpersistLua(_state, readStream);
+	delete readStream;
 
 	// Permanents-Table is removed from stack
 	lua_remove(_state, -2);
@@ -149,11 +149,6 @@ Common::Array<int> Graph::getPath(int source, int target) {
 	return result;
 }
 
-void PathFinder::setWalkboxes(const Common::Array<Walkbox> &walkboxes) {
-	_walkboxes = walkboxes;
-	_graph = nullptr;
-}
-
 Math::Vector2d Walkbox::getClosestPointOnEdge(const Math::Vector2d &p) const {
 	int vi1 = -1;
 	int vi2 = -1;
@@ -191,115 +186,359 @@ Math::Vector2d Walkbox::getClosestPointOnEdge(const Math::Vector2d &p) const {
 	return Math::Vector2d(xu, yu);
 }
 
-bool PathFinder::inLineOfSight(const Math::Vector2d &start, const Math::Vector2d &to) {
-	const float epsilon = 0.5f;
+void PathFinder::setWalkboxes(const Common::Array<Walkbox> &walkboxes) {
+	_walkboxes = walkboxes;
+	_order.resize(_walkboxes.size());
+	_bounds.resize(_walkboxes.size());
+	for (uint i = 0; i < _walkboxes.size(); i++) {
+		_order[i] = i;
 
-	// Not in LOS if any of the ends is outside the polygon
-	if (!_walkboxes[0].contains(start) || !_walkboxes[0].contains(to))
-		return false;
+		const Common::Array<Vector2i> &polygon = _walkboxes[i].getPoints();
+		Common::Rect &bounds = _bounds[i];
+		bounds = polygon.empty() ? Common::Rect() : Common::Rect(polygon[0].x, polygon[0].y, polygon[0].x, polygon[0].y);
+		for (uint j = 1; j < polygon.size(); j++)
+			bounds.extend(Common::Rect(polygon[j].x, polygon[j].y, polygon[j].x, polygon[j].y));
+	}
 
-	// In LOS if it's the same start and end location
-	if (length(start - to) < epsilon)
-		return true;
+	_graphs.clear();
+	_graphs.resize(_walkboxes.size());
+	_startCosts.clear();
+	_queryGraphValid = false;
+	buildNodes();
+	buildSegmentIndex();
+}
 
-	// Not in LOS if any edge is intersected by the start-end line segment
+Common::Array<Walkbox> PathFinder::getWalkboxes() const {
+	Common::Array<Walkbox> result;
+	result.reserve(_order.size());
+	for (uint i = 0; i < _order.size(); i++)
+		result.push_back(_walkboxes[_order[i]]);
+	return result;
+}
+
+const Graph &PathFinder::getGraph() const {
+	if (_order.empty() || !_graphs[_order[0]].built || _startCosts.empty())
+		return _emptyGraph;
+	if (_queryGraphValid)
+		return _queryGraph;
+
+	// Only the overlay needs the start and end nodes with their edges, so
+	// they are copied along the walkbox graph here rather than in each query
+	_queryGraph = _graphs[_order[0]].graph;
+	const int startNodeIndex = _nodes.size();
+	const int endNodeIndex = startNodeIndex + 1;
+	_queryGraph.addNode(_queryStart);
+	_queryGraph.addNode(_queryEnd);
+	for (uint i = 0; i < _startEdges.size(); i++)
+		_queryGraph._edges[startNodeIndex].push_back(_startEdges[i]);
+	for (uint i = 0; i < _endCosts.size(); i++) {
+		if (_endCosts[i] >= 0.f)
+			_queryGraph._edges[i].push_back(GraphEdge(i, endNodeIndex, _endCosts[i]));
+	}
+	_queryGraphValid = true;
+	return _queryGraph;
+}
+
+void PathFinder::buildNodes() {
+	_nodes.clear();
+	_nodeWalkbox.clear();
+	_nodeConcave.clear();
+	_firstNode.resize(_walkboxes.size() + 1);
 	for (uint i = 0; i < _walkboxes.size(); i++) {
 		const Walkbox &walkbox = _walkboxes[i];
-		const Common::Array<Vector2i> &polygon = walkbox.getPoints();
+		_firstNode[i] = _nodes.size();
+		if (walkbox.getPoints().size() <= 2)
+			continue;
+
+		// The walkbox of the actor uses its concave vertices, the other visible
+		// walkboxes their convex ones, so a visible walkbox needs both
+		for (uint j = 0; j < walkbox.getPoints().size(); j++) {
+			const bool concave = walkbox.concave(j);
+			if (walkbox.isVisible() || concave) {
+				_nodes.push_back((Math::Vector2d)walkbox.getPoints()[j]);
+				_nodeWalkbox.push_back(i);
+				_nodeConcave.push_back(concave);
+			}
+		}
+	}
+	_firstNode[_walkboxes.size()] = _nodes.size();
+}
+
+void PathFinder::buildSegmentIndex() {
+	_segments.clear();
+	_cells.clear();
+	for (uint i = 0; i < _walkboxes.size(); i++) {
+		const Common::Array<Vector2i> &polygon = _walkboxes[i].getPoints();
 		const uint size = polygon.size();
 		for (uint j = 0; j < size; j++) {
-			Math::Vector2d v1 = (Math::Vector2d)polygon[j];
-			Math::Vector2d v2 = (Math::Vector2d)polygon[(j + 1) % size];
-			if (!lineSegmentsCross(start, to, v1, v2))
-				continue;
+			Segment segment;
+			segment.v1 = (Math::Vector2d)polygon[j];
+			segment.v2 = (Math::Vector2d)polygon[(j + 1) % size];
+			_segments.push_back(segment);
+		}
+	}
+	_segmentStamps.resize(_segments.size());
+	for (uint i = 0; i < _segmentStamps.size(); i++)
+		_segmentStamps[i] = 0;
+	_stamp = 0;
+
+	if (_segments.empty()) {
+		_gridSize = 0;
+		return;
+	}
+
+	Math::Vector2d min(_segments[0].v1), max(_segments[0].v1);
+	for (uint i = 0; i < _segments.size(); i++) {
+		const Math::Vector2d &v = _segments[i].v1;
+		min = Math::Vector2d(MIN(min.getX(), v.getX()), MIN(min.getY(), v.getY()));
+		max = Math::Vector2d(MAX(max.getX(), v.getX()), MAX(max.getY(), v.getY()));
+	}
+
+	_gridSize = CLIP<int>((int)sqrt((float)_segments.size()), 1, 32);
+	_gridOrigin = min;
+	_cellSize = Math::Vector2d(MAX((max.getX() - min.getX()) / _gridSize, 1.f), MAX((max.getY() - min.getY()) / _gridSize, 1.f));
+	_cells.resize(_gridSize * _gridSize);
+	for (uint i = 0; i < _segments.size(); i++) {
+		const Math::Vector2d c1 = getCell(_segments[i].v1);
+		const Math::Vector2d c2 = getCell(_segments[i].v2);
+		for (int y = (int)MIN(c1.getY(), c2.getY()); y <= (int)MAX(c1.getY(), c2.getY()); y++) {
+			for (int x = (int)MIN(c1.getX(), c2.getX()); x <= (int)MAX(c1.getX(), c2.getX()); x++) {
+				_cells[y * _gridSize + x].push_back(i);
+			}
+		}
+	}
+}
+
+Math::Vector2d PathFinder::getCell(const Math::Vector2d &pos) const {
+	const float x = floorf((pos.getX() - _gridOrigin.getX()) / _cellSize.getX());
+	const float y = floorf((pos.getY() - _gridOrigin.getY()) / _cellSize.getY());
+	return Math::Vector2d(CLIP(x, 0.f, (float)(_gridSize - 1)), CLIP(y, 0.f, (float)(_gridSize - 1)));
+}
+
+bool PathFinder::crossesWalkboxEdge(const Math::Vector2d &start, const Math::Vector2d &to) {
+	const float epsilon = 0.5f;
+	if (!_gridSize)
+		return false;
 
-			// In some cases a 'snapped' endpoint is just a little over the line due to rounding errors. So a 0.5 margin is used to tackle those cases.
-			if ((distanceToSegment(start, v1, v2) > epsilon) && (distanceToSegment(to, v1, v2) > epsilon))
-				return false;
+	if (++_stamp == 0) {
+		for (uint i = 0; i < _segmentStamps.size(); i++)
+			_segmentStamps[i] = 0;
+		_stamp = 1;
+	}
+
+	// Both bounding boxes are widened by a unit, so that rounding errors
+	// cannot hide a crossing lying on a cell border
+	const Math::Vector2d margin(1.f, 1.f);
+	const Math::Vector2d c1 = getCell(Math::Vector2d(MIN(start.getX(), to.getX()), MIN(start.getY(), to.getY())) - margin);
+	const Math::Vector2d c2 = getCell(Math::Vector2d(MAX(start.getX(), to.getX()), MAX(start.getY(), to.getY())) + margin);
+	for (int y = (int)c1.getY(); y <= (int)c2.getY(); y++) {
+		for (int x = (int)c1.getX(); x <= (int)c2.getX(); x++) {
+			const Common::Array<uint> &cell = _cells[y * _gridSize + x];
+			for (uint i = 0; i < cell.size(); i++) {
+				if (_segmentStamps[cell[i]] == _stamp)
+					continue;
+				_segmentStamps[cell[i]] = _stamp;
+
+				const Segment &segment = _segments[cell[i]];
+				if (!lineSegmentsCross(start, to, segment.v1, segment.v2))
+					continue;
+
+				// In some cases a 'snapped' endpoint is just a little over the line due to rounding errors. So a 0.5 margin is used to tackle those cases.
+				if ((distanceToSegment(start, segment.v1, segment.v2) > epsilon) && (distanceToSegment(to, segment.v1, segment.v2) > epsilon))
+					return true;
+			}
 		}
 	}
+	return false;
+}
+
+bool PathFinder::inLineOfSight(uint walkboxIndex, const Math::Vector2d &start, const Math::Vector2d &to) {
+	const float epsilon = 0.5f;
+	const Walkbox &walkbox = _walkboxes[walkboxIndex];
+
+	// Not in LOS if any of the ends is outside the polygon
+	if (!walkbox.contains(start) || !walkbox.contains(to))
+		return false;
+
+	// In LOS if it's the same start and end location
+	if (length(start - to) < epsilon)
+		return true;
+
+	// Not in LOS if any edge is intersected by the start-end line segment
+	if (crossesWalkboxEdge(start, to))
+		return false;
 
 	// Finally the middle point in the segment determines if in LOS or not
 	const Math::Vector2d v2 = (start + to) / 2.0f;
-	if (!_walkboxes[0].contains(v2))
+	if (!walkbox.contains(v2))
 		return false;
-	for (uint i = 1; i < _walkboxes.size(); i++) {
+	for (uint i = 0; i < _walkboxes.size(); i++) {
+		// Nothing outside of its bounds is strictly inside a walkbox
+		const Common::Rect &bounds = _bounds[i];
+		if ((i == walkboxIndex) || (v2.getX() < bounds.left - 1) || (v2.getX() > bounds.right + 1) || (v2.getY() < bounds.top - 1) || (v2.getY() > bounds.bottom + 1))
+			continue;
 		if (_walkboxes[i].contains(v2, false))
 			return false;
 	}
 	return true;
 }
 
-Common::SharedPtr<Graph> PathFinder::createGraph() {
-	Common::SharedPtr<Graph> result(new Graph());
-	for (uint i = 0; i < _walkboxes.size(); i++) {
-		const Walkbox &walkbox = _walkboxes[i];
-		if (walkbox.getPoints().size() > 2) {
-			bool firstWalkbox = (i == 0);
-			if (!walkbox.isVisible())
-				firstWalkbox = true;
-			for (uint j = 0; j < walkbox.getPoints().size(); j++) {
-				if (walkbox.concave(j) == firstWalkbox) {
-					Math::Vector2d vertex = (Math::Vector2d)walkbox.getPoints()[j];
-					result->_concaveVertices.push_back(vertex);
-					result->addNode(vertex);
-				}
-			}
-		}
+bool PathFinder::isNodeUsed(uint walkbox, uint node) const {
+	const uint nodeWalkbox = _nodeWalkbox[node];
+	const bool firstWalkbox = (nodeWalkbox == walkbox) || !_walkboxes[nodeWalkbox].isVisible();
+	return _nodeConcave[node] == firstWalkbox;
+}
+
+const PathFinder::WalkGraph &PathFinder::getWalkGraph(uint walkbox) {
+	WalkGraph &result = _graphs[walkbox];
+	if (result.built)
+		return result;
+
+	Graph &graph = result.graph;
+	for (uint i = 0; i < _nodes.size(); i++) {
+		graph.addNode(_nodes[i]);
+		if (isNodeUsed(walkbox, i))
+			graph._concaveVertices.push_back(_nodes[i]);
 	}
 
-	for (uint i = 0; i < result->_concaveVertices.size(); i++) {
-		for (uint j = 0; j < result->_concaveVertices.size(); j++) {
-			const Math::Vector2d c1(result->_concaveVertices[i]);
-			const Math::Vector2d c2(result->_concaveVertices[j]);
-			if (inLineOfSight(c1, c2)) {
+	// Edges are added in increasing node order, so the edges of each node
+	// stay sorted by destination, and thus grouped by walkbox
+	for (uint i = 0; i < _nodes.size(); i++) {
+		if (!isNodeUsed(walkbox, i))
+			continue;
+		for (uint j = i; j < _nodes.size(); j++) {
+			if (!isNodeUsed(walkbox, j))
+				continue;
+			const Math::Vector2d &c1 = _nodes[i];
+			const Math::Vector2d &c2 = _nodes[j];
+			if (inLineOfSight(walkbox, c1, c2) || ((i != j) && inLineOfSight(walkbox, c2, c1))) {
 				const float d = distance(c1, c2);
-				result->addEdge(GraphEdge(i, j, d));
+				graph._edges[i].push_back(GraphEdge(i, j, d));
+				if (i != j)
+					graph._edges[j].push_back(GraphEdge(j, i, d));
 			}
 		}
 	}
+
+	const uint numWalkboxes = _walkboxes.size();
+	result.groups.resize(_nodes.size() * (numWalkboxes + 1));
+	for (uint i = 0; i < _nodes.size(); i++) {
+		const Common::Array<GraphEdge> &edges = graph._edges[i];
+		uint *groups = &result.groups[i * (numWalkboxes + 1)];
+		uint e = 0;
+		for (uint w = 0; w < numWalkboxes; w++) {
+			groups[w] = e;
+			while ((e < edges.size()) && (edges[e].to < (int)_firstNode[w + 1]))
+				e++;
+		}
+		groups[numWalkboxes] = edges.size();
+	}
+
+	result.built = true;
 	return result;
 }
 
+const Math::Vector2d &PathFinder::getNodePos(int node) const {
+	const int numNodes = _nodes.size();
+	if (node < numNodes)
+		return _nodes[node];
+	return (node == numNodes) ? _queryStart : _queryEnd;
+}
+
+void PathFinder::relax(IndexedPriorityQueue &pq, int from, int to, float cost) {
+	const float Hcost = length(getNodePos(to) - _queryEnd);
+	const float Gcost = _gCost[from] + cost;
+	if (_sf[to] < 0) {
+		_fCost[to] = Gcost + Hcost;
+		_gCost[to] = Gcost;
+		pq.insert(to);
+		_sf[to] = from;
+	} else if (Gcost < _gCost[to] && _spt[to] < 0) {
+		_fCost[to] = Gcost + Hcost;
+		_gCost[to] = Gcost;
+		pq.reorderUp();
+		_sf[to] = from;
+	}
+}
+
+void PathFinder::search(const WalkGraph &walkGraph) {
+	// Same search as AStar, with the edges of the start and end nodes kept
+	// aside and each node's edges visited in the order of _order
+	const int source = _nodes.size();
+	const int target = source + 1;
+	const uint numWalkboxes = _walkboxes.size();
+
+	_gCost.resize(_nodes.size() + 2);
+	_fCost.resize(_nodes.size() + 2);
+	_spt.resize(_nodes.size() + 2);
+	_sf.resize(_nodes.size() + 2);
+	for (uint i = 0; i < _gCost.size(); i++) {
+		_gCost[i] = 0.f;
+		_fCost[i] = 0.f;
+		_spt[i] = -1;
+		_sf[i] = -1;
+	}
+
+	IndexedPriorityQueue pq(_fCost);
+	pq.insert(source);
+	while (!pq.isEmpty()) {
+		const int NCN = pq.pop();
+		_spt[NCN] = _sf[NCN];
+		if (NCN == target)
+			continue;
+
+		if (NCN == source) {
+			for (uint i = 0; i < _startEdges.size(); i++)
+				relax(pq, NCN, _startEdges[i].to, _startEdges[i].cost);
+			continue;
+		}
+
+		const Common::Array<GraphEdge> &edges = walkGraph.graph._edges[NCN];
+		const uint *groups = &walkGraph.groups[NCN * (numWalkboxes + 1)];
+		for (uint i = 0; i < numWalkboxes; i++) {
+			const uint walkbox = _order[i];
+			for (uint j = groups[walkbox]; j < groups[walkbox + 1]; j++)
+				relax(pq, NCN, edges[j].to, edges[j].cost);
+		}
+		if (_startCosts[NCN] >= 0.f)
+			relax(pq, NCN, source, _startCosts[NCN]);
+		if (_endCosts[NCN] >= 0.f)
+			relax(pq, NCN, target, _endCosts[NCN]);
+	}
+}
+
 Common::Array<Math::Vector2d> PathFinder::calculatePath(const Math::Vector2d &s, const Math::Vector2d &t) {
 	Math::Vector2d start(s);
 	Math::Vector2d to(t);
 	Common::Array<Math::Vector2d> result;
 	if (!_walkboxes.empty()) {
 		// find the walkbox where the actor is and put it first
-		for (uint i = 0; i < _walkboxes.size(); i++) {
-			const Walkbox &wb = _walkboxes[i];
+		for (uint i = 0; i < _order.size(); i++) {
+			const Walkbox &wb = _walkboxes[_order[i]];
 			if (wb.contains(start) && (i != 0)) {
-				_graph.reset();
-				SWAP(_walkboxes[0], _walkboxes[i]);
+				SWAP(_order[0], _order[i]);
 				break;
 			}
 		}
 
 		// if no walkbox has been found => find the nearest walkbox
-		if (!_walkboxes[0].contains(start)) {
-			Common::Array<float> dists(_walkboxes.size());
-			for (uint i = 0; i < _walkboxes.size(); i++) {
-				const Walkbox &wb = _walkboxes[i];
+		if (!_walkboxes[_order[0]].contains(start)) {
+			Common::Array<float> dists(_order.size());
+			for (uint i = 0; i < _order.size(); i++) {
+				const Walkbox &wb = _walkboxes[_order[i]];
 				dists[i] = distance(wb.getClosestPointOnEdge(start), start);
 			}
 
 			const size_t index = minIndex(dists);
-			if (index != 0) {
-				_graph.reset();
-				SWAP(_walkboxes[0], _walkboxes[index]);
-			}
+			if (index != 0)
+				SWAP(_order[0], _order[index]);
 		}
 
-		if (!_graph)
-			_graph = createGraph();
-
-		// create new node on start position
-		_walkgraph = *_graph;
-		const uint startNodeIndex = _walkgraph._nodes.size();
+		const uint walkbox = _order[0];
+		const WalkGraph &walkGraph = getWalkGraph(walkbox);
 
 		// if destination is not inside current walkable area, then get the closest point
-		const Walkbox &wb = _walkboxes[0];
+		const Walkbox &wb = _walkboxes[walkbox];
 		if (wb.isVisible() && !wb.contains(start)) {
 			start = wb.getClosestPointOnEdge(start);
 		}
@@ -308,38 +547,62 @@ Common::Array<Math::Vector2d> PathFinder::calculatePath(const Math::Vector2d &s,
 		}
 		// we don't want the actor to walk in a different walkbox
 		// then check if endpoint is inside one of the other walkboxes and find the closest point on edge
-		for (uint i = 1; i < _walkboxes.size(); i++) {
-			if (_walkboxes[i].contains(to)) {
-				to = _walkboxes[i].getClosestPointOnEdge(to);
+		for (uint i = 1; i < _order.size(); i++) {
+			if (_walkboxes[_order[i]].contains(to)) {
+				to = _walkboxes[_order[i]].getClosestPointOnEdge(to);
 				break;
 			}
 		}
 
-		_walkgraph.addNode(start);
-
-		for (uint i = 0; i < _walkgraph._concaveVertices.size(); i++) {
-			const Math::Vector2d c = _walkgraph._concaveVertices[i];
-			if (inLineOfSight(start, c))
-				_walkgraph.addEdge(GraphEdge(startNodeIndex, i, distance(start, c)));
+		// attach the start and end nodes to the graph
+		const int startNodeIndex = _nodes.size();
+		const int endNodeIndex = startNodeIndex + 1;
+		_queryStart = start;
+		_queryEnd = to;
+		_queryGraphValid = false;
+		_startEdges.clear();
+		_startCosts.resize(_nodes.size());
+		_endCosts.resize(_nodes.size());
+		for (uint i = 0; i < _nodes.size(); i++) {
+			_startCosts[i] = -1.f;
+			_endCosts[i] = -1.f;
 		}
 
-		// create new node on end position
-		const uint endNodeIndex = _walkgraph._nodes.size();
-		_walkgraph.addNode(to);
+		for (uint i = 0; i < _order.size(); i++) {
+			const uint w = _order[i];
+			for (uint j = _firstNode[w]; j < _firstNode[w + 1]; j++) {
+				if (!isNodeUsed(walkbox, j))
+					continue;
+				const Math::Vector2d &c = _nodes[j];
+				if (inLineOfSight(walkbox, start, c)) {
+					_startCosts[j] = distance(start, c);
+					_startEdges.push_back(GraphEdge(startNodeIndex, j, _startCosts[j]));
+				}
+			}
+		}
 
-		for (uint i = 0; i < _walkgraph._concaveVertices.size(); i++) {
-			const Math::Vector2d c = _walkgraph._concaveVertices[i];
-			if (inLineOfSight(to, c))
-				_walkgraph.addEdge(GraphEdge(i, endNodeIndex, distance(to, c)));
+		for (uint i = 0; i < _order.size(); i++) {
+			const uint w = _order[i];
+			for (uint j = _firstNode[w]; j < _firstNode[w + 1]; j++) {
+				if (isNodeUsed(walkbox, j) && inLineOfSight(walkbox, to, _nodes[j]))
+					_endCosts[j] = distance(to, _nodes[j]);
+			}
 		}
 
-		if (inLineOfSight(start, to))
-			_walkgraph.addEdge(GraphEdge(startNodeIndex, endNodeIndex, distance(start, to)));
+		if (inLineOfSight(walkbox, start, to))
+			_startEdges.push_back(GraphEdge(startNodeIndex, endNodeIndex, distance(start, to)));
+
+		search(walkGraph);
 
-		const Common::Array<int> indices = _walkgraph.getPath(startNodeIndex, endNodeIndex);
-		for (uint i = 0; i < indices.size(); i++) {
-			const int index = indices[i];
-			result.push_back(_walkgraph._nodes[index]);
+		Common::Array<int> indices;
+		int nd = endNodeIndex;
+		indices.push_back(nd);
+		while ((nd != startNodeIndex) && (_spt[nd] >= 0)) {
+			nd = _spt[nd];
+			indices.push_back(nd);
+		}
+		for (uint i = indices.size(); i > 0; i--) {
+			result.push_back(getNodePos(indices[i - 1]));
 		}
 	}
 	return result;
@@ -108,24 +108,82 @@ private:
 };
 
 // A PathFinder is used to find a walkable path within one or several walkboxes.
+//
+// The walkbox where the actor is comes first in _order, and one graph is built
+// for each of those walkboxes the first time it is needed, so moving between
+// walkboxes never rebuilds anything. The start and end positions of a query
+// are attached to that graph without modifying it; getGraph() only assembles
+// both into one graph for the debug overlay.
 class PathFinder {
 public:
 	void setWalkboxes(const Common::Array<Walkbox> &walkboxes);
-	Common::Array<Walkbox> getWalkboxes() const { return _walkboxes; }
+	Common::Array<Walkbox> getWalkboxes() const;
 	Common::Array<Math::Vector2d> calculatePath(const Math::Vector2d &start, const Math::Vector2d &to);
 	void setDirty(bool dirty) { _isDirty = dirty; }
 	bool isDirty() const { return _isDirty; }
-	const Graph &getGraph() const { return _walkgraph; }
+	const Graph &getGraph() const;
 
 private:
-	Common::SharedPtr<Graph> createGraph();
-	bool inLineOfSight(const Math::Vector2d &start, const Math::Vector2d &to);
+	struct WalkGraph {
+		Graph graph;
+		// The edges from node n to the nodes of walkbox w start at
+		// graph._edges[n][groups[n * (walkboxes + 1) + w]]
+		Common::Array<uint> groups;
+		bool built = false;
+	};
+
+	struct Segment {
+		Math::Vector2d v1;
+		Math::Vector2d v2;
+	};
+
+	void buildNodes();
+	void buildSegmentIndex();
+	const WalkGraph &getWalkGraph(uint walkbox);
+	bool isNodeUsed(uint walkbox, uint node) const;
+	bool inLineOfSight(uint walkbox, const Math::Vector2d &start, const Math::Vector2d &to);
+	bool crossesWalkboxEdge(const Math::Vector2d &start, const Math::Vector2d &to);
+	Math::Vector2d getCell(const Math::Vector2d &pos) const;
+	const Math::Vector2d &getNodePos(int node) const;
+	void relax(IndexedPriorityQueue &pq, int from, int to, float cost);
+	void search(const WalkGraph &walkGraph);
 
 private:
 	Common::Array<Walkbox> _walkboxes;
-	Common::SharedPtr<Graph> _graph;
-	Graph _walkgraph;
+	Common::Array<Common::Rect> _bounds;
+	Common::Array<uint> _order; // Indices in _walkboxes, the walkbox of the actor first
 	bool _isDirty = true;
+
+	// Candidate graph nodes of all walkboxes: every vertex of the visible ones
+	// and the concave vertices of the holes
+	Common::Array<Math::Vector2d> _nodes;
+	Common::Array<uint> _nodeWalkbox;
+	Common::Array<bool> _nodeConcave;
+	Common::Array<uint> _firstNode; // First node of each walkbox, plus the total
+	Common::Array<WalkGraph> _graphs;
+	Graph _emptyGraph;
+	mutable Graph _queryGraph; // Graph of the last query, built by getGraph()
+	mutable bool _queryGraphValid = false;
+
+	// Uniform grid over the walkbox edges, for line of sight tests
+	Common::Array<Segment> _segments;
+	Common::Array<Common::Array<uint> > _cells;
+	Math::Vector2d _gridOrigin;
+	Math::Vector2d _cellSize;
+	int _gridSize = 0;
+	Common::Array<uint32> _segmentStamps;
+	uint32 _stamp = 0;
+
+	// Query state: the start and end nodes come after the graph nodes
+	Math::Vector2d _queryStart;
+	Math::Vector2d _queryEnd;
+	Common::Array<GraphEdge> _startEdges;
+	Common::Array<float> _startCosts; // Cost from each node back to the start node, or -1
+	Common::Array<float> _endCosts;   // Cost from each node to the end node, or -1
+	Common::Array<float> _gCost;
+	Common::Array<float> _fCost;
+	Common::Array<int> _spt; // Parent of each node in the shortest path tree, or -1
+	Common::Array<int> _sf;  // Parent of each node in the search frontier, or -1
 };
 
 } // namespace Twp
@@ -23,6 +23,7 @@
 
 #include "common/config-manager.h"
 #include "common/file.h"
+#include "common/random.h"
 #include "common/system.h"
 #include "image/bmp.h"
 #include "image/png.h"
@@ -42,9 +43,11 @@
 #include "ultima/ultima8/gumps/shape_viewer_gump.h"
 #include "ultima/ultima8/kernel/kernel.h"
 #include "ultima/ultima8/kernel/object_manager.h"
+#include "ultima/ultima8/misc/box.h"
 #include "ultima/ultima8/misc/id_man.h"
 #include "ultima/ultima8/ultima8.h"
 #include "ultima/ultima8/usecode/bit_set.h"
+#include "ultima/ultima8/usecode/uc_list.h"
 #include "ultima/ultima8/usecode/uc_machine.h"
 #include "ultima/ultima8/world/actors/avatar_mover_process.h"
 #include "ultima/ultima8/world/actors/main_actor.h"
@@ -55,6 +58,8 @@
 #include "ultima/ultima8/world/get_object.h"
 #include "ultima/ultima8/world/item_factory.h"
 #include "ultima/ultima8/world/item_selection_process.h"
+#include "ultima/ultima8/world/item_sorter.h"
+#include "ultima/ultima8/world/loop_script.h"
 #include "ultima/ultima8/world/target_reticle_process.h"
 #include "ultima/ultima8/world/world.h"
 
@@ -99,6 +104,7 @@ Debugger::Debugger() : GUI::Debugger() {
 	registerCmd("GameMapGump::dumpAllMaps", WRAP_METHOD(Debugger, cmdDumpAllMaps));
 	registerCmd("GameMapGump::incrementSortOrder", WRAP_METHOD(Debugger, cmdIncrementSortOrder));
 	registerCmd("GameMapGump::decrementSortOrder", WRAP_METHOD(Debugger, cmdDecrementSortOrder));
+	registerCmd("GameMapGump::toggleSortValidation", WRAP_METHOD(Debugger, cmdSortValidation));
 
 	registerCmd("Kernel::processTypes", WRAP_METHOD(Debugger, cmdProcessTypes));
 	registerCmd("Kernel::processInfo", WRAP_METHOD(Debugger, cmdProcessInfo));
@@ -153,6 +159,7 @@ Debugger::Debugger() : GUI::Debugger() {
 	registerCmd("QuitGump::verifyQuit", WRAP_METHOD(Debugger, cmdVerifyQuit));
 	registerCmd("ShapeViewerGump::U8ShapeViewer", WRAP_METHOD(Debugger, cmdU8ShapeViewer));
 	registerCmd("RenderSurface::benchmark", WRAP_METHOD(Debugger, cmdBenchmarkRenderSurface));
+	registerCmd("CurrentMap::benchmark", WRAP_METHOD(Debugger, cmdBenchmarkCurrentMap));
 
 #ifdef DEBUG_PATHFINDER
 	registerCmd("Pathfinder::visualDebug", WRAP_METHOD(Debugger, cmdVisualDebugPathfinder));
@@ -690,6 +697,25 @@ bool Debugger::cmdFootpads(int argc, const char **argv) {
 	return false;
 }
 
+bool Debugger::cmdSortValidation(int argc, const char **argv) {
+	if (argc > 2) {
+		debugPrintf("Usage: %s [on|off]\n", argv[0]);
+		return true;
+	}
+
+	bool flag = !ItemSorter::getValidate();
+	if (argc > 1) {
+		if (scumm_stricmp(argv[1], "on") == 0 || scumm_stricmp(argv[1], "true") == 0)
+			flag = true;
+		else if (scumm_stricmp(argv[1], "off") == 0 || scumm_stricmp(argv[1], "false") == 0)
+			flag = false;
+	}
+
+	ItemSorter::setValidate(flag);
+	debugPrintf("Display list validation %s\n", flag ? "enabled" : "disabled");
+	return true;
+}
+
 bool Debugger::cmdGridlines(int argc, const char **argv) {
 	if (argc > 2) {
 		debugPrintf("Usage: %s [on|off|<number>]\n", argv[0]);
@@ -1736,6 +1762,79 @@ bool Debugger::cmdBenchmarkRenderSurface(int argc, const char **argv) {
 	return true;
 }
 
+bool Debugger::cmdBenchmarkCurrentMap(int argc, const char **argv) {
+	if (argc != 2) {
+		debugPrintf("Usage: %s <iterations>\n", argv[0]);
+		debugPrintf("Runs map searches around the avatar with and without chunk bounds.\n");
+		return true;
+	}
+
+	const MainActor *mainActor = getMainActor();
+	if (!mainActor) {
+		debugPrintf("No main actor\n");
+		return true;
+	}
+
+	int count = atoi(argv[1]);
+	CurrentMap *currentmap = World::get_instance()->getCurrentMap();
+	const Point3 pt = mainActor->getLocation();
+	const uint32 shapeflags = mainActor->getShapeInfo()->_flags;
+	int32 dims[3];
+	mainActor->getFootpadWorld(dims[0], dims[1], dims[2]);
+
+	static const uint8 script[] = { LS_TOKEN_TRUE, LS_TOKEN_END };
+	const bool wasEnabled = currentmap->isChunkBoundsEnabled();
+
+	// Run the same queries on both passes, and keep a checksum of the
+	// results of each one to check they are identical.
+	Common::Array<uint32> results[2];
+	uint32 elapsed[2];
+	for (int pass = 0; pass < 2; pass++) {
+		Common::RandomSource rnd("ultima8_benchmark");
+		rnd.setSeed(1);
+		currentmap->setChunkBoundsEnabled(pass == 0);
+
+		uint32 start = g_system->getMillis();
+		for (int i = 0; i < count; i++) {
+			const int32 x = pt.x + rnd.getRandomNumberRngSigned(-1024, 1024);
+			const int32 y = pt.y + rnd.getRandomNumberRngSigned(-1024, 1024);
+			uint32 sum = 0;
+
+			UCList itemlist(2);
+			currentmap->areaSearch(&itemlist, script, sizeof(script), nullptr, 512, false, x, y);
+			for (unsigned int j = 0; j < itemlist.getSize(); j++)
+				sum = sum * 31 + itemlist.getuint16(j);
+
+			const Box target(x, y, pt.z, dims[0], dims[1], dims[2]);
+			PositionInfo info = currentmap->getPositionInfo(target, Box(), shapeflags, mainActor->getObjId());
+			sum = sum * 31 + (info.valid ? 1 : 0) + (info.supported ? 2 : 0);
+			sum = sum * 31 + (info.blocker ? info.blocker->getObjId() : 0);
+			sum = sum * 31 + (info.land ? info.land->getObjId() : 0);
+			sum = sum * 31 + (info.roof ? info.roof->getObjId() : 0);
+
+			Common::List<CurrentMap::SweepItem> hits;
+			currentmap->sweepTest(pt, Point3(x, y, pt.z), dims, shapeflags, mainActor->getObjId(), false, &hits);
+			for (const auto &hit : hits)
+				sum = sum * 31 + hit._item + hit._hitTime;
+
+			results[pass].push_back(sum);
+		}
+		elapsed[pass] = g_system->getMillis() - start;
+	}
+	currentmap->setChunkBoundsEnabled(wasEnabled);
+
+	int mismatches = 0;
+	for (int i = 0; i < count; i++) {
+		if (results[0][i] != results[1][i])
+			mismatches++;
+	}
+
+	debugPrintf("With chunk bounds: %d\n", elapsed[0]);
+	debugPrintf("Without chunk bounds: %d\n", elapsed[1]);
+	debugPrintf("Mismatched results: %d/%d\n", mismatches, count);
+	return true;
+}
+
 bool Debugger::cmdVisualDebugPathfinder(int argc, const char **argv) {
 #ifdef DEBUG_PATHFINDER
 	if (argc != 2) {
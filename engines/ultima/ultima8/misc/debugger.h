@@ -67,6 +67,7 @@ private:
 	// Game Map Gump
 	bool cmdHighlightItems(int argc, const char **argv);
 	bool cmdFootpads(int argc, const char **argv);
+	bool cmdSortValidation(int argc, const char **argv);
 	bool cmdGridlines(int argc, const char **argv);
 	bool cmdDumpMap(int argc, const char **argvv);
 	bool cmdDumpAllMaps(int argc, const char **argv);
@@ -132,6 +133,7 @@ private:
 	bool cmdPlayMovie(int argc, const char **argv);
 	bool cmdPlayMusic(int argc, const char **argv);
 	bool cmdBenchmarkRenderSurface(int argc, const char **argv);
+	bool cmdBenchmarkCurrentMap(int argc, const char **argv);
 	bool cmdVisualDebugPathfinder(int argc, const char **argv);
 
 	void dumpCurrentMap(); // helper function
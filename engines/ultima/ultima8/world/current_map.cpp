@@ -52,10 +52,21 @@ typedef Common::List<Item *> item_list;
 const int INT_MAX_VALUE = 0x7fffffff;
 const int INT_MIN_VALUE = -INT_MAX_VALUE - 1;
 
+// Distance an item's box can extend from its origin, in either x or y so
+// flipping the item doesn't change it.
+static int32 getItemReach(const Item *item) {
+	int32 xd, yd, zd;
+	item->getFootpadWorld(xd, yd, zd);
+	return MAX(xd, yd);
+}
+
 CurrentMap::CurrentMap() : _currentMap(0), _eggHatcher(0),
-	  _fastXMin(-1), _fastYMin(-1), _fastXMax(-1), _fastYMax(-1) {
+	  _fastXMin(-1), _fastYMin(-1), _fastXMax(-1), _fastYMax(-1),
+	  _chunkBoundsEnabled(true) {
 	for (unsigned int i = 0; i < MAP_NUM_CHUNKS; i++) {
 		memset(_fast[i], false, sizeof(uint32)*MAP_NUM_CHUNKS / 32);
+		memset(_chunkReach[i], 0, sizeof(int32)*MAP_NUM_CHUNKS);
+		memset(_chunkStray[i], 0, sizeof(int32)*MAP_NUM_CHUNKS);
 	}
 
 	if (GAME_IS_U8) {
@@ -84,6 +95,8 @@ void CurrentMap::clear() {
 			_items[i][j].clear();
 		}
 		memset(_fast[i], false, sizeof(uint32)*MAP_NUM_CHUNKS / 32);
+		memset(_chunkReach[i], 0, sizeof(int32)*MAP_NUM_CHUNKS);
+		memset(_chunkStray[i], 0, sizeof(int32)*MAP_NUM_CHUNKS);
 	}
 
 	_fastXMin =  _fastYMin = _fastXMax = _fastYMax = -1;
@@ -147,6 +160,8 @@ void CurrentMap::writeback() {
 				}
 			}
 			_items[i][j].clear();
+			_chunkReach[i][j] = 0;
+			_chunkStray[i][j] = 0;
 		}
 	}
 
@@ -249,6 +264,7 @@ void CurrentMap::addItem(Item *item) {
 #endif
 
 	_items[cx][cy].push_front(item);
+	_chunkReach[cx][cy] = MAX(_chunkReach[cx][cy], getItemReach(item));
 	item->setExtFlag(Item::EXT_INCURMAP);
 
 	Egg *egg = dynamic_cast<Egg *>(item);
@@ -284,6 +300,7 @@ void CurrentMap::addItemToEnd(Item *item) {
 #endif
 
 	_items[cx][cy].push_back(item);
+	_chunkReach[cx][cy] = MAX(_chunkReach[cx][cy], getItemReach(item));
 	item->setExtFlag(Item::EXT_INCURMAP);
 
 	Egg *egg = dynamic_cast<Egg *>(item);
@@ -396,6 +413,63 @@ void CurrentMap::removeItemFromList(Item *item, int32 oldx, int32 oldy) {
 
 	_items[cx][cy].remove(item);
 	item->clearExtFlag(Item::EXT_INCURMAP);
+
+	// Only the largest item can shrink the reach of the chunk
+	if (getItemReach(item) >= _chunkReach[cx][cy])
+		recalculateChunkReach(cx, cy);
+}
+
+void CurrentMap::updateItemFootpad(const Item *item) {
+	Point3 pt = item->getLocation();
+
+	if (pt.x < 0 || pt.x >= _mapChunkSize * MAP_NUM_CHUNKS ||
+	        pt.y < 0 || pt.y >= _mapChunkSize * MAP_NUM_CHUNKS)
+		return;
+
+	int32 cx = pt.x / _mapChunkSize;
+	int32 cy = pt.y / _mapChunkSize;
+	_chunkReach[cx][cy] = MAX(_chunkReach[cx][cy], getItemReach(item));
+}
+
+void CurrentMap::updateItemStray(const Item *item, int32 x, int32 y) {
+	Point3 pt = item->getLocation();
+
+	if (pt.x < 0 || pt.x >= _mapChunkSize * MAP_NUM_CHUNKS ||
+	        pt.y < 0 || pt.y >= _mapChunkSize * MAP_NUM_CHUNKS)
+		return;
+
+	int32 cx = pt.x / _mapChunkSize;
+	int32 cy = pt.y / _mapChunkSize;
+	int32 stray = MAX(MAX(cx * _mapChunkSize - x, x - (cx + 1) * _mapChunkSize),
+	                  MAX(cy * _mapChunkSize - y, y - (cy + 1) * _mapChunkSize));
+	_chunkStray[cx][cy] = MAX(_chunkStray[cx][cy], stray);
+}
+
+void CurrentMap::recalculateChunkReach(int cx, int cy) {
+	int32 reach = 0;
+	for (const auto *item : _items[cx][cy])
+		reach = MAX(reach, getItemReach(item));
+	_chunkReach[cx][cy] = reach;
+}
+
+bool CurrentMap::chunkMayOverlap(int cx, int cy, const Box &area) const {
+	if (!_chunkBoundsEnabled)
+		return true;
+	if (_items[cx][cy].empty())
+		return false;
+
+	// Item origins lie inside the chunk, or at most its stray distance
+	// outside, and their boxes extend towards negative x and y by at most
+	// the reach of the chunk.
+	const int32 stray = _chunkStray[cx][cy];
+	const int32 reach = _chunkReach[cx][cy] + stray;
+	const int32 minx = cx * _mapChunkSize - reach;
+	const int32 maxx = (cx + 1) * _mapChunkSize + stray;
+	const int32 miny = cy * _mapChunkSize - reach;
+	const int32 maxy = (cy + 1) * _mapChunkSize + stray;
+
+	return minx <= area._x && maxx >= area._x - area._xd &&
+	       miny <= area._y && maxy >= area._y - area._yd;
 }
 
 // Check to see if the chunk is on the screen
@@ -579,6 +653,9 @@ void CurrentMap::areaSearch(UCList *itemlist, const uint8 *loopscript,
 	//
 	for (int cy = miny; cy <= maxy; cy++) {
 		for (int cx = minx; cx <= maxx; cx++) {
+			if (!chunkMayOverlap(cx, cy, searchrange))
+				continue;
+
 			for (const auto *item : _items[cx][cy]) {
 				if (item->hasExtFlags(Item::EXT_SPRITE))
 					continue;
@@ -621,6 +698,9 @@ void CurrentMap::surfaceSearch(UCList *itemlist, const uint8 *loopscript,
 
 	for (int cy = miny; cy <= maxy; cy++) {
 		for (int cx = minx; cx <= maxx; cx++) {
+			if (!chunkMayOverlap(cx, cy, searchrange))
+				continue;
+
 			for (const auto *item : _items[cx][cy]) {
 				if (item->getObjId() == check->getObjId())
 					continue;
@@ -713,6 +793,9 @@ PositionInfo CurrentMap::getPositionInfo(const Box &target, const Box &start, ui
 
 	for (int cx = minx; cx <= maxx; cx++) {
 		for (int cy = miny; cy <= maxy; cy++) {
+			if (!chunkMayOverlap(cx, cy, target))
+				continue;
+
 			for (const auto *item : _items[cx][cy]) {
 				if (item->getObjId() == id)
 					continue;
@@ -822,8 +905,14 @@ bool CurrentMap::scanForValidPosition(int32 x, int32 y, int32 z, const Item *ite
 	int maxy = (y / _mapChunkSize) + 1;
 	clipMapChunks(minx, maxx, miny, maxy);
 
+	// Items further away than scansize can't affect the masks
+	const Box scanrange(x + scansize, y + scansize, z, xd + scansize * 2, yd + scansize * 2, zd);
+
 	for (int cx = minx; cx <= maxx; cx++) {
 		for (int cy = miny; cy <= maxy; cy++) {
+			if (!chunkMayOverlap(cx, cy, scanrange))
+				continue;
+
 			for (const auto *citem : _items[cx][cy]) {
 				if (citem->getObjId() == item->getObjId())
 					continue;
@@ -978,6 +1067,13 @@ bool CurrentMap::sweepTest(const Point3 &start, const Point3 &end,
 
 	clipMapChunks(minx, maxx, miny, maxy);
 
+	// Area covered by the item over the whole sweep
+	const int32 sweepx = MAX(start.x, end.x);
+	const int32 sweepy = MAX(start.y, end.y);
+	const Box sweeprange(sweepx, sweepy, 0,
+						 sweepx - MIN(start.x, end.x) + dims[0],
+						 sweepy - MIN(start.y, end.y) + dims[1], 0);
+
 	// Get velocity, extents, and centre of item
 	int32 vel[3];
 	int32 ext[3];
@@ -1007,6 +1103,9 @@ bool CurrentMap::sweepTest(const Point3 &start, const Point3 &end,
 
 	for (int cx = minx; cx <= maxx; cx++) {
 		for (int cy = miny; cy <= maxy; cy++) {
+			if (!chunkMayOverlap(cx, cy, sweeprange))
+				continue;
+
 			for (const auto *other_item : _items[cx][cy]) {
 				if (other_item->getObjId() == item)
 					continue;
@@ -74,6 +74,22 @@ public:
 	void removeItemFromList(Item *item, int32 oldx, int32 oldy);
 	void removeItem(Item *item);
 
+	//! Update the chunk bounds after an item in the map changed shape
+	void updateItemFootpad(const Item *item);
+
+	//! Update the chunk bounds before an item in the map is placed at x/y
+	//! without being moved to the matching chunk (see Item::setLocation)
+	void updateItemStray(const Item *item, int32 x, int32 y);
+
+	//! Enable or disable skipping chunks using the chunk bounds in searches.
+	//! Only meant for comparing against the full search when debugging.
+	void setChunkBoundsEnabled(bool enabled) {
+		_chunkBoundsEnabled = enabled;
+	}
+	bool isChunkBoundsEnabled() const {
+		return _chunkBoundsEnabled;
+	}
+
 	//! Add an item to the list of possible targets (in Crusader)
 	void addTargetItem(const Item *item);
 	//! Remove an item from the list of possible targets (in Crusader)
@@ -200,6 +216,12 @@ private:
 	//! clip the given map chunk numbers to iterate over them safely
 	static void clipMapChunks(int &minx, int &maxx, int &miny, int &maxy);
 
+	//! Check if any item in the given chunk can overlap the area in x/y
+	bool chunkMayOverlap(int cx, int cy, const Box &area) const;
+
+	//! Recalculate the reach of a chunk from the items it contains
+	void recalculateChunkReach(int cx, int cy);
+
 	Map *_currentMap;
 
 	// item lists. Lots of them :-)
@@ -214,6 +236,15 @@ private:
 
 	int _mapChunkSize;
 
+	//! Largest x or y footpad of the items in each chunk. Items are stored
+	//! in the chunk containing their origin, so this bounds how far their
+	//! boxes can reach into the neighbouring chunks.
+	int32 _chunkReach[MAP_NUM_CHUNKS][MAP_NUM_CHUNKS];
+	//! Furthest distance outside of each chunk that the location of one of
+	//! its items has been set to, without moving the item to another chunk.
+	int32 _chunkStray[MAP_NUM_CHUNKS][MAP_NUM_CHUNKS];
+	bool _chunkBoundsEnabled;
+
 	//! Items that are "targetable" in Crusader. It might be faster to store
 	//! this in a more fancy data structure, but this works fine.
 	ObjId _targets[MAP_NUM_TARGET_ITEMS];
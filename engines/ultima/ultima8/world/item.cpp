@@ -147,15 +147,18 @@ const Item *Item::getTopItem() const {
 }
 
 void Item::setLocation(int32 X, int32 Y, int32 Z) {
+	// The item stays in the map chunk of its current location, so searches
+	// must know how far it may be from there
+	if (_extendedFlags & EXT_INCURMAP)
+		World::get_instance()->getCurrentMap()->updateItemStray(this, X, Y);
+
 	_x = X;
 	_y = Y;
 	_z = Z;
 }
 
 void Item::setLocation(const Point3 &pt) {
-	_x = pt.x;
-	_y = pt.y;
-	_z = pt.z;
+	setLocation(pt.x, pt.y, pt.z);
 }
 
 void Item::move(const Point3 &pt) {
@@ -503,6 +506,10 @@ void Item::setShape(uint32 shape) {
 		_shape = shape;
 		_cachedShapeInfo = nullptr;
 	}
+
+	// A larger footpad may reach further into neighbouring map chunks
+	if (_extendedFlags & EXT_INCURMAP)
+		World::get_instance()->getCurrentMap()->updateItemFootpad(this);
 }
 
 bool Item::overlaps(const Item &item2) const {
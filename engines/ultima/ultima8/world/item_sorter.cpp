@@ -45,10 +45,12 @@ namespace Ultima8 {
 static const uint32 TRANSPARENT_COLOR = TEX32_PACK_RGBA(0x7F, 0x00, 0x00, 0x7F);
 static const uint32 HIGHLIGHT_COLOR = TEX32_PACK_RGBA(0xFF, 0xFF, 0x00, 0x1F);
 
+bool ItemSorter::_validate = false;
+
 ItemSorter::ItemSorter(int capacity) :
 	_shapes(nullptr), _clipWindow(0, 0, 0, 0), _items(nullptr), _itemsTail(nullptr),
 	_itemsUnused(nullptr), _painted(nullptr), _camSx(0), _camSy(0),
-	_sortLimit(0), _sortLimitChanged(false) {
+	_sortLimit(0), _sortLimitChanged(false), _addMatched(0), _reusing(false) {
 	int i = capacity;
 	while (i--) {
 		SortItem *next = _itemsUnused;
@@ -76,17 +78,17 @@ void ItemSorter::BeginDisplayList(const Common::Rect32 &clipWindow, const Point3
 	// Get the _shapes, if required
 	if (!_shapes) _shapes = GameData::get_instance()->getMainShapes();
 
-	// Set the clip window, and reset the item list
+	// Set the clip window, and start matching against the previous list
 	_clipWindow = clipWindow;
-
-	if (_itemsTail) {
-		_itemsTail->_next = _itemsUnused;
-		_itemsUnused = _items;
-	}
-
-	_items = nullptr;
-	_itemsTail = nullptr;
 	_painted = nullptr;
+	_addMatched = 0;
+	_reusing = true;
+
+#ifdef SORTITEM_OCCLUSION_EXPERIMENTAL
+	// Occlusion groups are not tracked, so always sort from scratch
+	removeRecords(0);
+	_reusing = false;
+#endif
 
 	// Screenspace bounding box bottom x coord (RNB x coord)
 	int32 camSx = (cam.x - cam.y) / 4;
@@ -94,6 +96,11 @@ void ItemSorter::BeginDisplayList(const Common::Rect32 &clipWindow, const Point3
 	int32 camSy = (cam.x + cam.y) / 8 - cam.z;
 
 	if (camSx != _camSx || camSy != _camSy) {
+		// Screenspace checks between items don't depend on the camera,
+		// so the kept items only need moving.
+		for (SortItem *si = _items; si != nullptr; si = si->_next)
+			si->translateScreen(_camSx - camSx, _camSy - camSy);
+
 		_camSx = camSx;
 		_camSy = camSy;
 
@@ -102,7 +109,123 @@ void ItemSorter::BeginDisplayList(const Common::Rect32 &clipWindow, const Point3
 	}
 }
 
+bool ItemSorter::matchesRecord(const AddRecord &rec, const Point3 &pt, uint32 shapeNum, uint32 frame_num, uint32 flags, uint32 ext_flags, uint16 itemNum) const {
+	if (rec._pt != pt || rec._shapeNum != shapeNum || rec._frame != frame_num ||
+		rec._flags != flags || rec._extFlags != ext_flags || rec._itemNum != itemNum)
+		return false;
+
+	if (!rec._valid)
+		return true;
+
+	// The item must still be clipped, or not, as before
+	Common::Rect32 sr = rec._worldSr;
+	sr.translate(-_camSx, -_camSy);
+	return _clipWindow.intersects(sr) == (rec._si != nullptr);
+}
+
+void ItemSorter::removeRecords(uint start) {
+	// Undo the additions in reverse order to restore the earlier state
+	for (uint i = _addLog.size(); i > start; i--) {
+		SortItem *si = _addLog[i - 1]._si;
+		if (!si)
+			continue;
+
+		if (si->_prev)
+			si->_prev->_next = si->_next;
+		else
+			_items = si->_next;
+		if (si->_next)
+			si->_next->_prev = si->_prev;
+		else
+			_itemsTail = si->_prev;
+
+		for (auto *d : si->_dependants)
+			d->_depends.remove(si);
+		for (auto *o : si->_occluding)
+			o->_occluded = false;
+		si->_dependants.clear();
+		si->_occluding.clear();
+
+		si->_next = _itemsUnused;
+		_itemsUnused = si;
+	}
+
+	_addLog.resize(start);
+}
+
+void ItemSorter::finishDisplayList() {
+	if (_reusing) {
+		// Remove items which were not added again this frame
+		removeRecords(_addMatched);
+		_reusing = false;
+
+		if (_validate)
+			validateDisplayList();
+	}
+
+	for (SortItem *si = _items; si != nullptr; si = si->_next)
+		si->_order = -1;
+}
+
+void ItemSorter::validateDisplayList() {
+	// Sort all the items again from scratch and compare
+	ItemSorter full(0);
+	full._shapes = _shapes;
+	full._clipWindow = _clipWindow;
+	full._camSx = _camSx;
+	full._camSy = _camSy;
+	for (const auto &rec : _addLog)
+		full.AddItem(rec._pt, rec._shapeNum, rec._frame, rec._flags, rec._extFlags, rec._itemNum);
+
+	const SortItem *si1 = _items;
+	const SortItem *si2 = full._items;
+	for (; si1 != nullptr && si2 != nullptr; si1 = si1->_next, si2 = si2->_next) {
+		bool same = si1->_itemNum == si2->_itemNum && si1->_shapeNum == si2->_shapeNum &&
+					si1->_frame == si2->_frame && si1->getBoxBounds() == si2->getBoxBounds() &&
+					si1->_sxBot == si2->_sxBot && si1->_syBot == si2->_syBot &&
+					si1->_occluded == si2->_occluded;
+
+		SortItem::DependsList::iterator d1 = si1->_depends.begin();
+		SortItem::DependsList::iterator d2 = si2->_depends.begin();
+		for (; same && d1 != si1->_depends.end() && d2 != si2->_depends.end(); ++d1, ++d2) {
+			same = (*d1)->_itemNum == (*d2)->_itemNum && (*d1)->_shapeNum == (*d2)->_shapeNum &&
+				   (*d1)->getBoxBounds() == (*d2)->getBoxBounds();
+		}
+		if (same && (d1 != si1->_depends.end() || d2 != si2->_depends.end()))
+			same = false;
+
+		if (!same) {
+			warning("ItemSorter: kept display list differs from full sort at %s", si1->dumpInfo().c_str());
+			return;
+		}
+	}
+
+	if (si1 != nullptr || si2 != nullptr)
+		warning("ItemSorter: kept display list length differs from full sort");
+}
+
 void ItemSorter::AddItem(const Point3 &pt, uint32 shapeNum, uint32 frame_num, uint32 flags, uint32 ext_flags, uint16 itemNum) {
+	if (_reusing) {
+		// Same as the previous frame so far, so the item is already sorted
+		if (_addMatched < _addLog.size() &&
+			matchesRecord(_addLog[_addMatched], pt, shapeNum, frame_num, flags, ext_flags, itemNum)) {
+			_addMatched++;
+			return;
+		}
+
+		removeRecords(_addMatched);
+		_reusing = false;
+	}
+
+	AddRecord rec;
+	rec._pt = pt;
+	rec._shapeNum = shapeNum;
+	rec._frame = frame_num;
+	rec._flags = flags;
+	rec._extFlags = ext_flags;
+	rec._itemNum = itemNum;
+	rec._valid = false;
+	rec._si = nullptr;
 
 	// First thing, get a SortItem to use (first of unused)
 	if (!_itemsUnused)
@@ -123,6 +246,7 @@ void ItemSorter::AddItem(const Point3 &pt, uint32 shapeNum, uint32 frame_num, ui
 			last_invalid_frame = si->_frame;
 			last_invalid_shape = si->_shapeNum;
 		}
+		_addLog.push_back(rec);
 		return;
 	}
 
@@ -151,9 +275,14 @@ void ItemSorter::AddItem(const Point3 &pt, uint32 shapeNum, uint32 frame_num, ui
 		si->_sr.bottom = si->_sr.top + frame->_height;
 	}
 
+	rec._valid = true;
+	rec._worldSr = si->_sr;
+	rec._worldSr.translate(_camSx, _camSy);
+
 	// Do Clipping here
 	if (!_clipWindow.intersects(si->_sr)) {
 		// Clipped away entirely - don't add to the list.
+		_addLog.push_back(rec);
 		return;
 	}
 
@@ -186,6 +315,8 @@ void ItemSorter::AddItem(const Point3 &pt, uint32 shapeNum, uint32 frame_num, ui
 	// Stictly speaking the vector will sort of leak memory, since they
 	// are never deleted
 	si->_depends.clear();
+	si->_dependants.clear();
+	si->_occluding.clear();
 
 	// Iterate the list and compare _shapes
 
@@ -230,11 +361,13 @@ void ItemSorter::AddItem(const Point3 &pt, uint32 shapeNum, uint32 frame_num, ui
 				} else {
 					// si1 is behind si2, so add it to si2's dependency list
 					si2->_depends.insert_sorted(si);
+					si->_dependants.push_back(si2);
 				}
 			} else {
 				if (si->_occl && si->occludes(*si2)) {
 					// Occluded, but we can't remove it from the list
 					si2->_occluded = true;
+					si->_occluding.push_back(si2);
 				} else {
 					// si2 is behind si1, so add it to si1's dependency list
 					si->_depends.insert_sorted(si2);
@@ -267,6 +400,9 @@ void ItemSorter::AddItem(const Point3 &pt, uint32 shapeNum, uint32 frame_num, ui
 		si->_prev = _itemsTail;
 		_itemsTail = si;
 	}
+
+	rec._si = si;
+	_addLog.push_back(rec);
 }
 
 void ItemSorter::AddItem(const Item *add) {
@@ -281,6 +417,8 @@ void ItemSorter::PaintDisplayList(RenderSurface *surf, bool item_highlight, bool
 		surf->fill32(color, _clipWindow);
 	}
 
+	finishDisplayList();
+
 #ifdef SORTITEM_OCCLUSION_EXPERIMENTAL
 	int32 minZ = _items ? _items->_z : 0;
 
@@ -542,6 +680,7 @@ uint16 ItemSorter::Trace(int32 x, int32 y, HitFace *face, bool item_highlight) {
 	SortItem *selected;
 
 	if (!_painted) { // If no painted item found, we need to sort the items
+		finishDisplayList();
 		it = _items;
 		_painted = nullptr;
 		while (it != nullptr) {
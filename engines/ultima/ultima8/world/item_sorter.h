@@ -22,7 +22,9 @@
 #ifndef ULTIMA8_WORLD_ITEMSORTER_H
 #define ULTIMA8_WORLD_ITEMSORTER_H
 
+#include "common/array.h"
 #include "common/rect.h"
+#include "ultima/ultima8/misc/point3.h"
 
 namespace Ultima {
 namespace Ultima8 {
@@ -31,9 +33,21 @@ class MainShapeArchive;
 class Item;
 class RenderSurface;
 struct SortItem;
-struct Point3;
 
 class ItemSorter {
+	// Parameters of an AddItem call, and the resulting sort item
+	struct AddRecord {
+		Point3          _pt;
+		uint32          _shapeNum;
+		uint32          _frame;
+		uint32          _flags;
+		uint32          _extFlags;
+		uint16          _itemNum;
+		bool            _valid;     // The shape frame exists
+		Common::Rect32  _worldSr;   // Screenspace rect without camera offset
+		SortItem        *_si;       // Added sort item, or null if skipped
+	};
+
 	MainShapeArchive    *_shapes;
 	Common::Rect32      _clipWindow;
 
@@ -46,6 +60,15 @@ class ItemSorter {
 	int32       _sortLimit;
 	bool        _sortLimitChanged;
 
+	// The display list is kept between frames. Items are only removed and
+	// sorted again from the first AddItem call which differs from the
+	// previous frame, as the result depends on the order they were added.
+	Common::Array<AddRecord> _addLog;
+	uint        _addMatched;
+	bool        _reusing;
+
+	static bool _validate;
+
 public:
 	ItemSorter(int capacity);
 	~ItemSorter();
@@ -69,8 +92,21 @@ public:
 
 	void IncSortLimit(int count);
 
+	//! Check the display list kept from previous frames against a full sort
+	static void setValidate(bool validate) {
+		_validate = validate;
+	}
+	static bool getValidate() {
+		return _validate;
+	}
+
 private:
 	bool PaintSortItem(RenderSurface *surf, SortItem *si, bool showFootpad, int gridlines);
+
+	bool matchesRecord(const AddRecord &rec, const Point3 &pt, uint32 shapeNum, uint32 frame_num, uint32 flags, uint32 ext_flags, uint16 itemNum) const;
+	void removeRecords(uint start);
+	void finishDisplayList();
+	void validateDisplayList();
 };
 
 } // End of namespace Ultima8
@@ -207,6 +207,22 @@ struct SortItem {
 			tail = nn;
 		}
 
+		void remove(SortItem *other) {
+			for (Node *n = list; n != nullptr; n = n->_next) {
+				if (n->val != other)
+					continue;
+
+				if (n->_prev) n->_prev->_next = n->_next;
+				else list = n->_next;
+				if (n->_next) n->_next->_prev = n->_prev;
+				else tail = n->_prev;
+
+				n->_next = unused;
+				unused = n;
+				return;
+			}
+		}
+
 		DependsList() : list(nullptr), tail(nullptr), unused(nullptr) { }
 
 		~DependsList() {
@@ -222,11 +238,27 @@ struct SortItem {
 	// All this Items dependencies (i.e. all objects behind)
 	DependsList _depends;
 
+	// Items this item was added as a dependency to, and items it marked as
+	// occluded, when it was added. Used to take it out of the list again.
+	DependsList _dependants;
+	DependsList _occluding;
+
 	// Functions
 
 	// Set worldspace bounds and calculate screenspace at center point
 	void setBoxBounds(const Box &box, int32 sx, int32 sy);
 
+	// Move the screenspace bounds, after the camera moved
+	void translateScreen(int32 dx, int32 dy) {
+		_sxLeft += dx;
+		_sxRight += dx;
+		_sxTop += dx;
+		_syTop += dy;
+		_sxBot += dx;
+		_syBot += dy;
+		_sr.translate(dx, dy);
+	}
+
 	inline Box getBoxBounds() const {
 		Box box;
 		box._x = _x;
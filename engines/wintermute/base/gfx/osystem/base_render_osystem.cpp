@@ -36,12 +36,20 @@
 #include "engines/util.h"
 
 #include "common/system.h"
+#include "common/hash-ptr.h"
 #include "common/queue.h"
 #include "common/config-manager.h"
 
 #include "graphics/cursorman.h"
 
 #define DIRTY_RECT_LIMIT 800
+// Size of the tiles used to track the changed parts of the screen
+#define DIRTY_TILE_SIZE 32
+// Max amount of separately redrawn rects, before merging them all into one
+#define DIRTY_RECT_MAX_COUNT 64
+// Limits for the cache of scaled/rotated surfaces; the age is in frames
+#define TRANSFORMED_SURFACES_MAX_SIZE (32 * 1024 * 1024)
+#define TRANSFORMED_SURFACES_MAX_AGE 600
 
 namespace Wintermute {
 
@@ -58,7 +66,10 @@ BaseRenderOSystem::BaseRenderOSystem(BaseGame *inGame) : BaseRenderer(inGame) {
 
 	_borderLeft = _borderRight = _borderTop = _borderBottom = 0;
 	_ratioX = _ratioY = 1.0f;
-	_dirtyRect = nullptr;
+	_tilesPerRow = _tilesPerColumn = 0;
+	_hasDirtyTiles = false;
+	_transformedSurfacesSize = 0;
+	_frameCount = 0;
 	_disableDirtyRects = false;
 	if (ConfMan.hasKey("dirty_rects")) {
 		_disableDirtyRects = !ConfMan.getBool("dirty_rects");
@@ -76,7 +87,7 @@ BaseRenderOSystem::~BaseRenderOSystem() {
 		delete ticket;
 	}
 
-	delete _dirtyRect;
+	_transformedSurfaces.clear();
 
 	_renderSurface->free();
 	delete _renderSurface;
@@ -128,6 +139,11 @@ bool BaseRenderOSystem::initRenderer(int width, int height, bool windowed) {
 	_renderSurface->create(g_system->getWidth(), g_system->getHeight(), g_system->getScreenFormat());
 	_active = true;
 
+	_tilesPerRow = (_renderSurface->w + DIRTY_TILE_SIZE - 1) / DIRTY_TILE_SIZE;
+	_tilesPerColumn = (_renderSurface->h + DIRTY_TILE_SIZE - 1) / DIRTY_TILE_SIZE;
+	_dirtyTiles.resize(_tilesPerRow * _tilesPerColumn);
+	clearDirtyTiles();
+
 	_clearColor = _renderSurface->format.ARGBToColor(255, 0, 0, 0);
 
 	return STATUS_OK;
@@ -150,8 +166,7 @@ bool BaseRenderOSystem::forcedFlip() {
 bool BaseRenderOSystem::flip() {
 	if (_skipThisFrame) {
 		_skipThisFrame = false;
-		delete _dirtyRect;
-		_dirtyRect = nullptr;
+		clearDirtyTiles();
 		g_system->updateScreen();
 		_needsFlip = false;
 
@@ -190,14 +205,16 @@ bool BaseRenderOSystem::flip() {
 		if (_disableDirtyRects || screenChanged) {
 			g_system->copyRectToScreen(_renderSurface->getPixels(), _renderSurface->pitch, 0, 0, _renderSurface->w, _renderSurface->h);
 		}
-		delete _dirtyRect;
-		_dirtyRect = nullptr;
+		clearDirtyTiles();
 		_needsFlip = false;
 	}
 	_lastFrameIter = _renderQueue.end();
 
 	g_system->updateScreen();
 
+	_frameCount++;
+	pruneTransformedSurfaces();
+
 	return STATUS_OK;
 }
 
@@ -315,6 +332,92 @@ void BaseRenderOSystem::invalidateTicketsFromSurface(BaseSurfaceOSystem *surf) {
 			invalidateTicket(*it);
 		}
 	}
+	invalidateTransformedSurfaces(surf);
+}
+
+bool BaseRenderOSystem::TransformedSurfaceKey::operator==(const TransformedSurfaceKey &other) const {
+	return _owner == other._owner &&
+	       _srcRect == other._srcRect &&
+	       _width == other._width &&
+	       _height == other._height &&
+	       _zoom == other._zoom &&
+	       _hotspot == other._hotspot &&
+	       _angle == other._angle &&
+	       _flip == other._flip &&
+	       _filtering == other._filtering;
+}
+
+uint BaseRenderOSystem::TransformedSurfaceKeyHash::operator()(const TransformedSurfaceKey &key) const {
+	uint hash = Common::Hash<BaseSurfaceOSystem *>()(key._owner);
+	hash = hash * 31 + (uint16)key._srcRect.left + ((uint16)key._srcRect.top << 16);
+	hash = hash * 31 + (uint16)key._width + ((uint16)key._height << 16);
+	hash = hash * 31 + (uint16)key._zoom.x + ((uint16)key._zoom.y << 16);
+	hash = hash * 31 + (uint)key._angle;
+	return hash;
+}
+
+Common::SharedPtr<Graphics::Surface> BaseRenderOSystem::getTransformedSurface(BaseSurfaceOSystem *owner, const Graphics::Surface *surf,
+                                                                              const Common::Rect &srcRect, const Common::Rect &dstRect,
+                                                                              const Graphics::TransformStruct &transform) {
+	TransformedSurfaceKey key;
+	key._owner = owner;
+	key._srcRect = srcRect;
+	key._width = dstRect.width();
+	key._height = dstRect.height();
+	key._zoom = transform._zoom;
+	key._hotspot = transform._hotspot;
+	key._angle = transform._angle;
+	key._flip = transform._flip;
+	key._filtering = _game->getBilinearFiltering();
+
+	TransformedSurfaceCache::iterator it = _transformedSurfaces.find(key);
+	if (it != _transformedSurfaces.end()) {
+		it->_value._lastUsedFrame = _frameCount;
+		return it->_value._surface;
+	}
+
+	const Graphics::Surface temp = surf->getSubArea(srcRect);
+	Graphics::Surface *result;
+	if (transform._angle != Graphics::kDefaultAngle) {
+		result = temp.rotoscale(transform, key._filtering);
+	} else {
+		result = temp.scale(dstRect.width(), dstRect.height(), key._filtering);
+	}
+
+	TransformedSurface &entry = _transformedSurfaces[key];
+	entry._surface = Common::SharedPtr<Graphics::Surface>(result, Graphics::SurfaceDeleter());
+	entry._lastUsedFrame = _frameCount;
+	_transformedSurfacesSize += result->pitch * result->h;
+	return entry._surface;
+}
+
+void BaseRenderOSystem::invalidateTransformedSurfaces(BaseSurfaceOSystem *surf) {
+	for (TransformedSurfaceCache::iterator it = _transformedSurfaces.begin(); it != _transformedSurfaces.end(); ++it) {
+		if (it->_key._owner == surf) {
+			_transformedSurfacesSize -= it->_value._surface->pitch * it->_value._surface->h;
+			_transformedSurfaces.erase(it);
+		}
+	}
+}
+
+void BaseRenderOSystem::pruneTransformedSurfaces() {
+	for (TransformedSurfaceCache::iterator it = _transformedSurfaces.begin(); it != _transformedSurfaces.end(); ++it) {
+		if (_frameCount - it->_value._lastUsedFrame > TRANSFORMED_SURFACES_MAX_AGE) {
+			_transformedSurfacesSize -= it->_value._surface->pitch * it->_value._surface->h;
+			_transformedSurfaces.erase(it);
+		}
+	}
+
+	while (_transformedSurfacesSize > TRANSFORMED_SURFACES_MAX_SIZE && !_transformedSurfaces.empty()) {
+		TransformedSurfaceCache::iterator oldest = _transformedSurfaces.begin();
+		for (TransformedSurfaceCache::iterator it = oldest; it != _transformedSurfaces.end(); ++it) {
+			if (it->_value._lastUsedFrame < oldest->_value._lastUsedFrame) {
+				oldest = it;
+			}
+		}
+		_transformedSurfacesSize -= oldest->_value._surface->pitch * oldest->_value._surface->h;
+		_transformedSurfaces.erase(oldest);
+	}
 }
 
 void BaseRenderOSystem::drawFromTicket(RenderTicket *renderTicket) {
@@ -354,12 +457,91 @@ void BaseRenderOSystem::drawFromQueuedTicket(const RenderQueueIterator &ticket)
 }
 
 void BaseRenderOSystem::addDirtyRect(const Common::Rect &rect) {
-	if (!_dirtyRect) {
-		_dirtyRect = new Common::Rect(rect);
-	} else {
-		_dirtyRect->extend(rect);
+	Common::Rect clipped(rect);
+	clipped.clip(_renderRect);
+	if (clipped.isEmpty() || _dirtyTiles.empty()) {
+		return;
+	}
+
+	const int left = MAX<int>(clipped.left, 0) / DIRTY_TILE_SIZE;
+	const int top = MAX<int>(clipped.top, 0) / DIRTY_TILE_SIZE;
+	const int right = MIN<int>((clipped.right - 1) / DIRTY_TILE_SIZE, _tilesPerRow - 1);
+	const int bottom = MIN<int>((clipped.bottom - 1) / DIRTY_TILE_SIZE, _tilesPerColumn - 1);
+	for (int y = top; y <= bottom; y++) {
+		for (int x = left; x <= right; x++) {
+			_dirtyTiles[y * _tilesPerRow + x] = true;
+		}
+	}
+	_hasDirtyTiles = true;
+}
+
+void BaseRenderOSystem::clearDirtyTiles() {
+	if (_hasDirtyTiles) {
+		for (uint i = 0; i < _dirtyTiles.size(); i++) {
+			_dirtyTiles[i] = false;
+		}
+	}
+	_hasDirtyTiles = false;
+}
+
+void BaseRenderOSystem::getDirtyRects(Common::Array<Common::Rect> &rects) const {
+	if (!_hasDirtyTiles) {
+		return;
+	}
+
+	// Every row of tiles is split into runs of dirty tiles, which are merged
+	// with the runs spanning the same columns in the row above.
+	Common::Array<uint> prevRuns, curRuns;
+	for (int y = 0; y < _tilesPerColumn; y++) {
+		curRuns.clear();
+		int x = 0;
+		while (x < _tilesPerRow) {
+			if (!_dirtyTiles[y * _tilesPerRow + x]) {
+				x++;
+				continue;
+			}
+			const int start = x;
+			while (x < _tilesPerRow && _dirtyTiles[y * _tilesPerRow + x]) {
+				x++;
+			}
+
+			Common::Rect run(start * DIRTY_TILE_SIZE, y * DIRTY_TILE_SIZE, x * DIRTY_TILE_SIZE, (y + 1) * DIRTY_TILE_SIZE);
+			bool merged = false;
+			for (uint i = 0; i < prevRuns.size(); i++) {
+				Common::Rect &above = rects[prevRuns[i]];
+				if (above.left == run.left && above.right == run.right) {
+					above.bottom = run.bottom;
+					curRuns.push_back(prevRuns[i]);
+					merged = true;
+					break;
+				}
+			}
+			if (!merged) {
+				curRuns.push_back(rects.size());
+				rects.push_back(run);
+			}
+		}
+		prevRuns = curRuns;
+	}
+
+	// The tiles may stick out of the render area
+	for (uint i = 0; i < rects.size();) {
+		rects[i].clip(_renderRect);
+		if (rects[i].isEmpty()) {
+			rects.remove_at(i);
+		} else {
+			i++;
+		}
+	}
+
+	if (rects.size() > DIRTY_RECT_MAX_COUNT) {
+		Common::Rect bounds = rects[0];
+		for (uint i = 1; i < rects.size(); i++) {
+			bounds.extend(rects[i]);
+		}
+		rects.clear();
+		rects.push_back(bounds);
 	}
-	_dirtyRect->clip(_renderRect);
 }
 
 void BaseRenderOSystem::drawTickets() {
@@ -378,7 +560,9 @@ void BaseRenderOSystem::drawTickets() {
 			++it;
 		}
 	}
-	if (!_dirtyRect || _dirtyRect->width() == 0 || _dirtyRect->height() == 0) {
+	Common::Array<Common::Rect> dirtyRects;
+	getDirtyRects(dirtyRects);
+	if (dirtyRects.empty()) {
 		it = _renderQueue.begin();
 		while (it != _renderQueue.end()) {
 			RenderTicket *ticket = *it;
@@ -393,38 +577,44 @@ void BaseRenderOSystem::drawTickets() {
 	// A special case: If the screen has one giant OPAQUE rect to be drawn, then we skip filling
 	// the background color. Typical use-case: Fullscreen FMVs.
 	// Caveat: The FPS-counter will invalidate this.
+	RenderTicket *opaqueTicket = nullptr;
 	if (it != _lastFrameIter && _renderQueue.front() == _renderQueue.back() && (*it)->_transform._alphaDisable == true) {
-		// If our single opaque rect fills the dirty rect, we can skip filling.
-		if (*_dirtyRect != (*it)->_dstRect) {
+		opaqueTicket = *it;
+	}
+
+	for (uint i = 0; i < dirtyRects.size(); i++) {
+		const Common::Rect &dirtyRect = dirtyRects[i];
+		// If our single opaque rect covers the dirty rect, we can skip filling.
+		if (!opaqueTicket || !opaqueTicket->_dstRect.contains(dirtyRect)) {
 			// Apply the clear-color to the dirty rect.
-			_renderSurface->fillRect(*_dirtyRect, _clearColor);
+			_renderSurface->fillRect(dirtyRect, _clearColor);
 		}
-		// Otherwise Do NOT fill.
-	} else {
-		// Apply the clear-color to the dirty rect.
-		_renderSurface->fillRect(*_dirtyRect, _clearColor);
-	}
-	for (; it != _renderQueue.end(); ++it) {
-		RenderTicket *ticket = *it;
-		if (ticket->_dstRect.intersects(*_dirtyRect)) {
-			// dstClip is the area we want redrawn.
-			Common::Rect dstClip(ticket->_dstRect);
-			// reduce it to the dirty rect
-			dstClip.clip(*_dirtyRect);
-			// we need to keep track of the position to redraw the dirty rect
-			Common::Rect pos(dstClip);
-			int16 offsetX = ticket->_dstRect.left;
-			int16 offsetY = ticket->_dstRect.top;
-			// convert from screen-coords to surface-coords.
-			dstClip.translate(-offsetX, -offsetY);
-
-			drawFromSurface(ticket, &pos, &dstClip);
-			_needsFlip = true;
+
+		for (it = _renderQueue.begin(); it != _renderQueue.end(); ++it) {
+			RenderTicket *ticket = *it;
+			if (ticket->_dstRect.intersects(dirtyRect)) {
+				// dstClip is the area we want redrawn.
+				Common::Rect dstClip(ticket->_dstRect);
+				// reduce it to the dirty rect
+				dstClip.clip(dirtyRect);
+				// we need to keep track of the position to redraw the dirty rect
+				Common::Rect pos(dstClip);
+				int16 offsetX = ticket->_dstRect.left;
+				int16 offsetY = ticket->_dstRect.top;
+				// convert from screen-coords to surface-coords.
+				dstClip.translate(-offsetX, -offsetY);
+
+				drawFromSurface(ticket, &pos, &dstClip);
+				_needsFlip = true;
+			}
 		}
-		// Some tickets want redraw but don't actually clip the dirty area (typically the ones that shouldn't become clear-color)
-		ticket->_wantsDraw = false;
+		g_system->copyRectToScreen(_renderSurface->getBasePtr(dirtyRect.left, dirtyRect.top), _renderSurface->pitch, dirtyRect.left, dirtyRect.top, dirtyRect.width(), dirtyRect.height());
+	}
+
+	// Some tickets want redraw but don't actually clip the dirty area (typically the ones that shouldn't become clear-color)
+	for (it = _renderQueue.begin(); it != _renderQueue.end(); ++it) {
+		(*it)->_wantsDraw = false;
 	}
-	g_system->copyRectToScreen(_renderSurface->getBasePtr(_dirtyRect->left, _dirtyRect->top), _renderSurface->pitch, _dirtyRect->left, _dirtyRect->top, _dirtyRect->width(), _dirtyRect->height());
 
 	it = _renderQueue.begin();
 	// Clean out the old tickets
@@ -565,6 +755,8 @@ void BaseRenderOSystem::endSaveLoad() {
 	// so just skip this single frame.
 	_skipThisFrame = true;
 	_lastFrameIter = _renderQueue.end();
+	_transformedSurfaces.clear();
+	_transformedSurfacesSize = 0;
 
 	_renderSurface->fillRect(Common::Rect(0, 0, _renderSurface->w, _renderSurface->h), _renderSurface->format.ARGBToColor(255, 0, 0, 0));
 	g_system->fillScreen(Common::Rect(0, 0, _renderSurface->w, _renderSurface->h), _renderSurface->format.ARGBToColor(255, 0, 0, 0));
@@ -30,8 +30,11 @@
 
 #include "engines/wintermute/base/gfx/base_renderer.h"
 
+#include "common/array.h"
+#include "common/hashmap.h"
 #include "common/rect.h"
 #include "common/list.h"
+#include "common/ptr.h"
 
 #include "graphics/managed_surface.h"
 #include "graphics/transform_struct.h"
@@ -54,6 +57,14 @@ class RenderTicket;
  * being equal, this information is then used to check whether the draw order changed,
  * which will then create a need for redrawing, as we draw with an alpha-channel here.
  *
+ * The changed parts of the screen are tracked on a grid of tiles, so that several
+ * small changes in distant parts of the screen only redraw the tiles they touch,
+ * instead of everything in the rectangle spanning all of them.
+ *
+ * Scaled and rotated copies of surfaces made for the tickets are kept in a cache,
+ * so that looping animations of scaled actors don't transform the same frames
+ * over and over again.
+ *
  * There is also a draw path that draws without tickets, for debugging purposes,
  * as well as to accommodate situations with large enough amounts of draw calls,
  * that there will be too much overhead involved with comparing the generated tickets.
@@ -85,6 +96,18 @@ public:
 
 	void invalidateTicket(RenderTicket *renderTicket);
 	void invalidateTicketsFromSurface(BaseSurfaceOSystem *surf);
+	/**
+	 * Get a scaled and/or rotated copy of a region of the surface, as required
+	 * by the transform. The copy is shared with earlier tickets using the same
+	 * region and transform, until the surface is modified.
+	 */
+	Common::SharedPtr<Graphics::Surface> getTransformedSurface(BaseSurfaceOSystem *owner, const Graphics::Surface *surf,
+	                                                           const Common::Rect &srcRect, const Common::Rect &dstRect,
+	                                                           const Graphics::TransformStruct &transform);
+	/**
+	 * Drop the cached transformed copies of the surface.
+	 */
+	void invalidateTransformedSurfaces(BaseSurfaceOSystem *surf);
 	/**
 	 * Insert a new ticket into the queue, adding a dirty rect
 	 * @param renderTicket the ticket to be added.
@@ -120,17 +143,58 @@ private:
 	 * @param rect the region to be marked as dirty
 	 */
 	void addDirtyRect(const Common::Rect &rect);
+	/**
+	 * Mark all the tiles as clean.
+	 */
+	void clearDirtyTiles();
+	/**
+	 * Convert the dirty tiles to a list of screen rects to be redrawn.
+	 */
+	void getDirtyRects(Common::Array<Common::Rect> &rects) const;
 	/**
 	 * Traverse the tickets that are dirty, and draw them
 	 */
 	void drawTickets();
+	/**
+	 * Drop the transformed surfaces which were not used for a while,
+	 * or the least recently used ones when the cache gets too large.
+	 */
+	void pruneTransformedSurfaces();
 	// Non-dirty-rects:
 	void drawFromSurface(RenderTicket *ticket);
 	// Dirty-rects:
 	void drawFromSurface(RenderTicket *ticket, Common::Rect *dstRect, Common::Rect *clipRect);
-	Common::Rect *_dirtyRect;
+	Common::Array<bool> _dirtyTiles;
+	int _tilesPerRow;
+	int _tilesPerColumn;
+	bool _hasDirtyTiles;
 	Common::List<RenderTicket *> _renderQueue;
 
+	struct TransformedSurfaceKey {
+		BaseSurfaceOSystem *_owner;
+		Common::Rect _srcRect;
+		int16 _width;
+		int16 _height;
+		Common::Point _zoom;
+		Common::Point _hotspot;
+		int32 _angle;
+		byte _flip;
+		bool _filtering;
+
+		bool operator==(const TransformedSurfaceKey &other) const;
+	};
+	struct TransformedSurfaceKeyHash {
+		uint operator()(const TransformedSurfaceKey &key) const;
+	};
+	struct TransformedSurface {
+		Common::SharedPtr<Graphics::Surface> _surface;
+		uint32 _lastUsedFrame;
+	};
+	typedef Common::HashMap<TransformedSurfaceKey, TransformedSurface, TransformedSurfaceKeyHash> TransformedSurfaceCache;
+	TransformedSurfaceCache _transformedSurfaces;
+	uint32 _transformedSurfacesSize;
+	uint32 _frameCount;
+
 	bool _needsFlip;
 	RenderQueueIterator _lastFrameIter;
 	Common::Rect _renderRect;
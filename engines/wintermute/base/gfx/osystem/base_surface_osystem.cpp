@@ -251,6 +251,9 @@ bool BaseSurfaceOSystem::invalidate() {
 		_game->addMem(-_width * _height * 4);
 		_surface->free();
 		_valid = false;
+
+		BaseRenderOSystem *renderer = static_cast<BaseRenderOSystem *>(_game->_renderer);
+		renderer->invalidateTransformedSurfaces(this);
 	}
 
 	return STATUS_OK;
@@ -28,6 +28,7 @@
 
 #include "engines/wintermute/base/base_game.h"
 #include "engines/wintermute/base/gfx/osystem/render_ticket.h"
+#include "engines/wintermute/base/gfx/osystem/base_render_osystem.h"
 #include "engines/wintermute/base/gfx/osystem/base_surface_osystem.h"
 
 #include "graphics/managed_surface.h"
@@ -47,10 +48,8 @@ RenderTicket::RenderTicket(BaseSurfaceOSystem *owner, const Graphics::Surface *s
 	if (surf) {
 		assert(surf->format.bytesPerPixel == 4);
 
-		// Get a clipped view of the surface
-		const Graphics::Surface temp = surf->getSubArea(*srcRect);
-
-		// Then copy and scale it as necessary
+		// Copy and scale the clipped surface as necessary; the scaled and
+		// rotated copies are shared through the renderer's cache
 		//
 		// NB: The numTimesX/numTimesY properties don't yet mix well with
 		// scaling and rotation, but there is no need for that functionality at
@@ -58,25 +57,18 @@ RenderTicket::RenderTicket(BaseSurfaceOSystem *owner, const Graphics::Surface *s
 		// NB: Mirroring and rotation are probably done in the wrong order.
 		// (Mirroring should most likely be done before rotation. See also
 		// TransformTools.)
-		if (_transform._angle != Graphics::kDefaultAngle) {
-			_surface = temp.rotoscale(transform, owner->_game->getBilinearFiltering());
-		} else if ((dstRect->width() != srcRect->width() ||
-			    dstRect->height() != srcRect->height()) &&
-			    _transform._numTimesX * _transform._numTimesY == 1) {
-			_surface = temp.scale(dstRect->width(), dstRect->height(), owner->_game->getBilinearFiltering());
+		if (_transform._angle != Graphics::kDefaultAngle ||
+		        ((dstRect->width() != srcRect->width() ||
+		          dstRect->height() != srcRect->height()) &&
+		         _transform._numTimesX * _transform._numTimesY == 1)) {
+			BaseRenderOSystem *renderer = static_cast<BaseRenderOSystem *>(owner->_game->_renderer);
+			_surface = renderer->getTransformedSurface(owner, surf, *srcRect, *dstRect, _transform);
 		} else {
-			_surface = new Graphics::Surface();
+			// Get a clipped view of the surface
+			const Graphics::Surface temp = surf->getSubArea(*srcRect);
+			_surface = Common::SharedPtr<Graphics::Surface>(new Graphics::Surface(), Graphics::SurfaceDeleter());
 			_surface->copyFrom(temp);
 		}
-	} else {
-		_surface = nullptr;
-	}
-}
-
-RenderTicket::~RenderTicket() {
-	if (_surface) {
-		_surface->free();
-		delete _surface;
 	}
 }
 
@@ -30,6 +30,7 @@
 
 #include "graphics/managed_surface.h"
 
+#include "common/ptr.h"
 #include "common/rect.h"
 
 namespace Wintermute {
@@ -47,13 +48,14 @@ class BaseSurfaceOSystem;
  * (Video-surfaces may even change their data). The promise that is made when a ticket
  * is created is that what the state was of the surface at THAT point, is what will end
  * up on screen at flip() time.
+ * Scaled and rotated copies are shared with the renderer's cache, which drops them
+ * as soon as the surface data changes, so the promise still holds.
  */
 class RenderTicket {
 public:
 	RenderTicket(BaseSurfaceOSystem *owner, const Graphics::Surface *surf, Common::Rect *srcRect, Common::Rect *dstRest, Graphics::TransformStruct transform);
 	RenderTicket() : _isValid(true), _wantsDraw(false), _transform(Graphics::TransformStruct()) {}
-	~RenderTicket();
-	const Graphics::Surface *getSurface() const { return _surface; }
+	const Graphics::Surface *getSurface() const { return _surface.get(); }
 	// Non-dirty-rects:
 	void drawToSurface(Graphics::ManagedSurface *_targetSurface) const;
 	// Dirty-rects:
@@ -70,7 +72,7 @@ public:
 	bool operator==(const RenderTicket &a) const;
 	const Common::Rect *getSrcRect() const { return &_srcRect; }
 private:
-	Graphics::Surface *_surface;
+	Common::SharedPtr<Graphics::Surface> _surface;
 	Common::Rect _srcRect;
 };
 
@@ -171,6 +171,7 @@ bool RenderManager::renderSceneToScreen(bool immediate, bool overlayOnly, bool p
 	if (!overlayOnly) {
 		Graphics::Surface *inputSurface = &_backgroundSurface;
 		Common::Rect outWndDirtyRect;
+		Common::Rect effectsDirtyRect;
 		// Apply graphical effects to temporary effects buffer and/or directly to current background image, as appropriate
 		if (!_effects.empty()) {
 			debugC(6, kDebugGraphics, "Rendering effects");
@@ -196,23 +197,37 @@ bool RenderManager::renderSceneToScreen(bool immediate, bool overlayOnly, bool p
 					blitSurfaceToSurface(*post, empty, _effectSurface, screenSpaceLocation.left, screenSpaceLocation.top);
 					debugC(1, kDebugGraphics, "windowRect %d,%d,%d,%d, screenSpaceLocation %d,%d,%d,%d", windowRect.left, windowRect.top, windowRect.bottom, windowRect.right, screenSpaceLocation.left, screenSpaceLocation.top, screenSpaceLocation.bottom, screenSpaceLocation.right);
 					screenSpaceLocation.clip(windowRect);
-					if (_backgroundSurfaceDirtyRect.isEmpty())
-						_backgroundSurfaceDirtyRect = screenSpaceLocation;
+					if (effectsDirtyRect.isEmpty())
+						effectsDirtyRect = screenSpaceLocation;
 					else
-						_backgroundSurfaceDirtyRect.extend(screenSpaceLocation);
+						effectsDirtyRect.extend(screenSpaceLocation);
 				}
 			}
 			debugC(5, kDebugGraphics, "\tCumulative render time this frame: %d ms", _system->getMillis() - startTime);
 		}
+		// Effects that were drawn last frame but have since been removed leave stale pixels behind unless redrawn
+		Common::Rect previousEffectsDirtyRect = _effectsDirtyRect;
+		_effectsDirtyRect = effectsDirtyRect;
+		if (!previousEffectsDirtyRect.isEmpty()) {
+			if (effectsDirtyRect.isEmpty())
+				effectsDirtyRect = previousEffectsDirtyRect;
+			else
+				effectsDirtyRect.extend(previousEffectsDirtyRect);
+		}
+		if (!effectsDirtyRect.isEmpty()) {
+			if (_backgroundSurfaceDirtyRect.isEmpty())
+				_backgroundSurfaceDirtyRect = effectsDirtyRect;
+			else
+				_backgroundSurfaceDirtyRect.extend(effectsDirtyRect);
+		}
 		// Apply panorama/tilt warp to background image
 		switch (_renderTable.getRenderState()) {
 		case RenderTable::PANORAMA:
 		case RenderTable::TILT:
 			debugC(5, kDebugGraphics, "Rendering panorama");
 			if (!_backgroundSurfaceDirtyRect.isEmpty()) {
-				_renderTable.mutateImage(&_warpedSceneSurface, inputSurface, _engine->getScriptManager()->getStateValue(StateKey_HighQuality));
+				outWndDirtyRect = _renderTable.mutateImage(&_warpedSceneSurface, inputSurface, _backgroundSurfaceDirtyRect, _engine->getScriptManager()->getStateValue(StateKey_HighQuality));
 				_outputSurface = &_warpedSceneSurface;
-				outWndDirtyRect = Common::Rect(_workingArea.width(), _workingArea.height());
 			}
 			break;
 		default:
@@ -105,6 +105,8 @@ private:
 	Graphics::Surface _backgroundSurface;
 	Graphics::ManagedSurface _workingManagedSurface;
 	Common::Rect _backgroundSurfaceDirtyRect;
+	// Screen area covered by graphical effects in the previous frame, which must be redrawn in case an effect was removed
+	Common::Rect _effectsDirtyRect;
 
 //TODO: Migrate this functionality to SubtitleManager to improve encapsulation
 //*
@@ -38,6 +38,11 @@ RenderTable::RenderTable(ZVision *engine, uint16 numColumns, uint16 numRows, con
 	assert(numRows != 0 && numColumns != 0);
 
 	_internalBuffer = new FilterPixel[numRows * numColumns];
+	_warpBuffer = new WarpPixel[numRows * numColumns];
+	_columnSrcMin = new int16[numColumns];
+	_columnSrcMax = new int16[numColumns];
+	_rowSrcMin = new int16[numRows];
+	_rowSrcMax = new int16[numRows];
 
 	memset(&_panoramaOptions, 0, sizeof(_panoramaOptions));
 	memset(&_tiltOptions, 0, sizeof(_tiltOptions));
@@ -45,10 +50,16 @@ RenderTable::RenderTable(ZVision *engine, uint16 numColumns, uint16 numRows, con
 	_halfColumns = floor((_numColumns - 1) / 2);
 	_halfWidth = (float)_numColumns / 2.0f - 0.5f;
 	_halfHeight = (float)_numRows / 2.0f - 0.5f;
+	generateWarpTable();
 }
 
 RenderTable::~RenderTable() {
 	delete[] _internalBuffer;
+	delete[] _warpBuffer;
+	delete[] _columnSrcMin;
+	delete[] _columnSrcMax;
+	delete[] _rowSrcMin;
+	delete[] _rowSrcMax;
 }
 
 void RenderTable::setRenderState(RenderState newState) {
@@ -129,56 +140,69 @@ void RenderTable::mutateImage(uint16 *sourceBuffer, uint16 *destBuffer, uint32 d
 }
 // */
 
-void RenderTable::mutateImage(Graphics::Surface *dstBuf, Graphics::Surface *srcBuf, bool highQuality) {
-	uint32 destOffset = 0;
-	uint32 sourceOffset = 0;
+Common::Rect RenderTable::mutateImage(Graphics::Surface *dstBuf, Graphics::Surface *srcBuf, const Common::Rect &srcDirtyRect, bool highQuality) {
 	uint16 *sourceBuffer = (uint16 *)srcBuf->getPixels();
 	uint16 *destBuffer = (uint16 *)dstBuf->getPixels();
 	if (highQuality != _highQuality) {
 		_highQuality = highQuality;
 		generateRenderTable();
 	}
+
+	// Only destination pixels sampling the dirty part of the source need to be warped again;
+	// the rest of dstBuf still holds the result of the previous call
+	Common::Rect dirtyRect;
+	if (_fullWarpPending) {
+		dirtyRect = Common::Rect(srcBuf->w, srcBuf->h);
+		_fullWarpPending = false;
+	} else if (!srcDirtyRect.isEmpty()) {
+		int16 left = srcBuf->w, right = 0;
+		for (int16 x = 0; x < srcBuf->w; ++x) {
+			if (_columnSrcMax[x] >= srcDirtyRect.left && _columnSrcMin[x] < srcDirtyRect.right) {
+				left = MIN(left, x);
+				right = x + 1;
+			}
+		}
+		int16 top = srcBuf->h, bottom = 0;
+		for (int16 y = 0; y < srcBuf->h; ++y) {
+			if (_rowSrcMax[y] >= srcDirtyRect.top && _rowSrcMin[y] < srcDirtyRect.bottom) {
+				top = MIN(top, y);
+				bottom = y + 1;
+			}
+		}
+		if (left < right && top < bottom)
+			dirtyRect = Common::Rect(left, top, right, bottom);
+	}
+	if (dirtyRect.isEmpty())
+		return dirtyRect;
+
 	uint32 mutationTime = _system->getMillis();
 	if (_highQuality) {
 		// Apply bilinear interpolation
-		for (int16 y = 0; y < srcBuf->h; ++y) {
-			sourceOffset = y * _numColumns;
-			for (int16 x = 0; x < srcBuf->w; ++x) {
-				const FilterPixel &curP = _internalBuffer[sourceOffset + x];
-				const uint32 srcIndexYT = y + curP._src.top;
-				const uint32 srcIndexYB = y + curP._src.bottom;
-				const uint32 srcIndexXL = x + curP._src.left;
-				const uint32 srcIndexXR = x + curP._src.right;
-				uint32 rTL, rTR, rBL, rBR;
-				uint32 gTL, gTR, gBL, gBR;
-				uint32 bTL, bTR, bBL, bBR;
-				splitColor(sourceBuffer[srcIndexYT * _numColumns + srcIndexXL], rTL, gTL, bTL);
-				splitColor(sourceBuffer[srcIndexYT * _numColumns + srcIndexXR], rTR, gTR, bTR);
-				splitColor(sourceBuffer[srcIndexYB * _numColumns + srcIndexXL], rBL, gBL, bBL);
-				splitColor(sourceBuffer[srcIndexYB * _numColumns + srcIndexXR], rBR, gBR, bBR);
-				const uint32 rF = curP._fTL * rTL + curP._fTR * rTR + curP._fBL * rBL + curP._fBR * rBR;
-				const uint32 gF = curP._fTL * gTL + curP._fTR * gTR + curP._fBL * gBL + curP._fBR * gBR;
-				const uint32 bF = curP._fTL * bTL + curP._fTR * bTR + curP._fBL * bBL + curP._fBR * bBR;
-				destBuffer[destOffset] = mergeColor(rF, gF, bF);
-				destOffset++;
+		for (int16 y = dirtyRect.top; y < dirtyRect.bottom; ++y) {
+			const uint32 rowIndex = y * _numColumns;
+			for (int16 x = dirtyRect.left; x < dirtyRect.right; ++x) {
+				const uint32 index = rowIndex + x;
+				const WarpPixel &curP = _warpBuffer[index];
+				const uint16 *srcT = sourceBuffer + index + curP.offset;
+				const uint16 *srcB = srcT + curP.downStep;
+				const uint32 top = blendColor(expandColor(srcT[0]), expandColor(srcT[curP.rightStep]), curP.xWeight);
+				const uint32 bottom = blendColor(expandColor(srcB[0]), expandColor(srcB[curP.rightStep]), curP.xWeight);
+				destBuffer[index] = packColor(blendColor(top, bottom, curP.yWeight));
 			}
 		}
 	} else {
 		// Apply nearest-neighbour interpolation
-		for (int16 y = 0; y < srcBuf->h; ++y) {
-			sourceOffset = y * _numColumns;
-			for (int16 x = 0; x < srcBuf->w; ++x) {
-				const uint32 index = sourceOffset + x;
-				// RenderTable only stores offsets from the original coordinates
-				const uint32 srcIndexX = x + (_internalBuffer[index]._xDir ? _internalBuffer[index]._src.right : _internalBuffer[index]._src.left);
-				const uint32 srcIndexY = y + (_internalBuffer[index]._yDir ? _internalBuffer[index]._src.bottom : _internalBuffer[index]._src.top);
-				destBuffer[destOffset] = sourceBuffer[srcIndexY * _numColumns + srcIndexX];
-				destOffset++;
+		for (int16 y = dirtyRect.top; y < dirtyRect.bottom; ++y) {
+			const uint32 rowIndex = y * _numColumns;
+			for (int16 x = dirtyRect.left; x < dirtyRect.right; ++x) {
+				const uint32 index = rowIndex + x;
+				destBuffer[index] = sourceBuffer[index + _warpBuffer[index].offset];
 			}
 		}
 	}
 	mutationTime = _system->getMillis() - mutationTime;
-	debugC(5, kDebugGraphics, "\tPanorama mutation time %dms, %s quality", mutationTime, _highQuality ? "high" : "low");
+	debugC(5, kDebugGraphics, "\tPanorama mutation time %dms, %s quality, %dx%d pixels", mutationTime, _highQuality ? "high" : "low", dirtyRect.width(), dirtyRect.height());
+	return dirtyRect;
 }
 
 void RenderTable::generateRenderTable() {
@@ -267,11 +291,51 @@ void RenderTable::generateLookupTable(bool tilt) {
 			}
 		}
 	}
+	generateWarpTable();
 	generationTime = _system->getMillis() - generationTime;
 	debugC(1, kDebugGraphics, "Render table generated, %s quality", _highQuality ? "high" : "low");
 	debugC(1, kDebugGraphics, "\tRender table generation time %dms", generationTime);
 }
 
+void RenderTable::generateWarpTable() {
+	for (uint x = 0; x < _numColumns; ++x) {
+		_columnSrcMin[x] = _numColumns;
+		_columnSrcMax[x] = -1;
+	}
+	for (uint y = 0; y < _numRows; ++y) {
+		_rowSrcMin[y] = _numRows;
+		_rowSrcMax[y] = -1;
+	}
+	for (uint y = 0; y < _numRows; ++y) {
+		const uint32 rowIndex = y * _numColumns;
+		for (uint x = 0; x < _numColumns; ++x) {
+			const FilterPixel &curP = _internalBuffer[rowIndex + x];
+			WarpPixel &warp = _warpBuffer[rowIndex + x];
+			if (_highQuality) {
+				warp.offset = curP._src.top * _numColumns + curP._src.left;
+				warp.downStep = (curP._src.bottom - curP._src.top) * _numColumns;
+				warp.rightStep = curP._src.right - curP._src.left;
+				warp.xWeight = (uint8)(curP._fX * 32.0f + 0.5f);
+				warp.yWeight = (uint8)(curP._fY * 32.0f + 0.5f);
+			} else {
+				const int16 srcX = curP._xDir ? curP._src.right : curP._src.left;
+				const int16 srcY = curP._yDir ? curP._src.bottom : curP._src.top;
+				warp.offset = srcY * _numColumns + srcX;
+				warp.downStep = 0;
+				warp.rightStep = 0;
+				warp.xWeight = 0;
+				warp.yWeight = 0;
+			}
+			// Flipped pixels have their left/right and top/bottom offsets swapped
+			_columnSrcMin[x] = MIN<int16>(_columnSrcMin[x], x + MIN(curP._src.left, curP._src.right));
+			_columnSrcMax[x] = MAX<int16>(_columnSrcMax[x], x + MAX(curP._src.left, curP._src.right));
+			_rowSrcMin[y] = MIN<int16>(_rowSrcMin[y], y + MIN(curP._src.top, curP._src.bottom));
+			_rowSrcMax[y] = MAX<int16>(_rowSrcMax[y], y + MAX(curP._src.top, curP._src.bottom));
+		}
+	}
+	_fullWarpPending = true;
+}
+
 void RenderTable::setPanoramaFoV(float fov) {
 	assert(fov > 0.0f);
 
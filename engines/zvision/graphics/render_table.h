@@ -36,8 +36,8 @@ public:
 	bool _yDir = false; // false up, true down
 	Common::Rect _src = Common::Rect(0, 0); // Coordinates of four panorama image pixels around actual working window pixel
 
-	float _fX, _fY, _fTL, _fTR, _fBL, _fBR;
-	
+	float _fX = 0.0f, _fY = 0.0f; // Fractional distance of the sample point from the top left pixel
+
 	FilterPixel() {}
 	FilterPixel(float x, float y, bool highQuality = false) {
 		_src.left = int16(floor(x));
@@ -47,10 +47,6 @@ public:
 		if (highQuality) {
 			_fX = x - (float)_src.left;
 			_fY = y - (float)_src.top;
-			_fTL = (1 - _fX) * (1 - _fY);
-			_fTR = _fX * (1 - _fY);
-			_fBL = (1 - _fX) * _fY;
-			_fBR = _fX * _fY;
 		} else {
 			// Nearest neighbour
 			_xDir = (x - _src.left) > 0.5f;
@@ -91,15 +87,30 @@ private:
 	bool _highQuality = false;
 	const Graphics::PixelFormat _pixelFormat;
 
-	inline void splitColor(uint16 &color, uint32 &r, uint32 &g, uint32 &b) const {
-		// NB Left & right shifting unnecessary for interpolating & recombining, so not bothering in order to save cycles
-		r = color & 0x001f;
-		g = color & 0x03e0;
-		b = color & 0x7c00;
+	// Compact form of _internalBuffer used by mutateImage(), rebuilt whenever the lookup table changes
+	struct WarpPixel {
+		int32 offset;   // Source index of the left/top sample, relative to the destination index
+		int32 downStep; // Source index step to the bottom samples; 0 or +/- one row
+		int8 rightStep; // Source index step to the right samples; 0 or +/- one pixel
+		uint8 xWeight;  // Weights of the right and bottom samples in 1/32nds
+		uint8 yWeight;
+	};
+	WarpPixel *_warpBuffer;
+	// Range of source columns read by each destination column, and of source rows read by each destination row
+	int16 *_columnSrcMin, *_columnSrcMax;
+	int16 *_rowSrcMin, *_rowSrcMax;
+	bool _fullWarpPending = true;
+
+	// RGB555 with green moved to the upper half word, leaving 5 spare bits above each channel,
+	// so that all three channels can be blended with a single multiply each
+	static inline uint32 expandColor(uint16 color) {
+		return (color | (color << 16)) & 0x03e07c1f;
+	}
+	static inline uint32 blendColor(uint32 a, uint32 b, uint32 weight) {
+		return ((a * (32 - weight) + b * weight) >> 5) & 0x03e07c1f;
 	}
-	inline uint16 mergeColor(const uint32 &r, const uint32 &g, const uint32 &b) const {
-		// NB Red uses the lowest bits in RGB555 and so doesn't need its fractional bits masked away after averaging
-		return r | (g & 0x03e0) | (b & 0x7c00);
+	static inline uint16 packColor(uint32 color) {
+		return (color | (color >> 16)) & 0x7fff;
 	}
 
 
@@ -126,7 +137,8 @@ public:
 	const Common::Point convertWarpedCoordToFlatCoord(const Common::Point &point);  // input point in working area coordinates
 
 // void mutateImage(uint16 *sourceBuffer, uint16 *destBuffer, uint32 destWidth, const Common::Rect &subRect);
-	void mutateImage(Graphics::Surface *dstBuf, Graphics::Surface *srcBuf, bool filter = false);
+	// Warps the pixels of dstBuf which depend on srcDirtyRect and returns the area of dstBuf that was updated
+	Common::Rect mutateImage(Graphics::Surface *dstBuf, Graphics::Surface *srcBuf, const Common::Rect &srcDirtyRect, bool filter = false);
 	template <typename I>
 	Common::String pixelToBinary(const I &pixel, bool splitColors = true) const {
 		uint8 bits = sizeof(pixel) << 3;
@@ -160,6 +172,7 @@ public:
 
 private:
 	void generateLookupTable(bool tilt = false);
+	void generateWarpTable();
 	void generatePanoramaLookupTable();
 	void generateTiltLookupTable();
 };
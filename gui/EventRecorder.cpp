@@ -32,6 +32,7 @@ DECLARE_SINGLETON(GUI::EventRecorder);
 #include "backends/timer/sdl/sdl-timer.h"
 #include "backends/mixer/mixer.h"
 #include "common/config-manager.h"
+#include "common/file.h"
 #include "common/md5.h"
 #include "gui/gui-manager.h"
 #include "gui/widget.h"
@@ -83,6 +84,11 @@ EventRecorder::EventRecorder() {
 	_screenshotPeriod = 0;
 	_playbackFile = nullptr;
 	_recordFile = nullptr;
+	_profileFile = nullptr;
+	_profileFrames = 0;
+	_profileLastMillis = 0;
+	_profileTotalMillis = 0;
+	_profileMaxMillis = 0;
 }
 
 EventRecorder::~EventRecorder() {
@@ -104,6 +110,7 @@ void EventRecorder::deinit() {
 		delete _controlPanel;
 		_controlPanel = nullptr;
 	}
+	closeProfile();
 	debugC(1, kDebugLevelEventRec, "playback:action=stopplayback");
 	Common::EventDispatcher *eventDispatcher = g_system->getEventManager()->getEventDispatcher();
 	eventDispatcher->unregisterSource(this);
@@ -246,6 +253,54 @@ bool EventRecorder::processDelayMillis() {
 	return !_fastPlayback;
 }
 
+void EventRecorder::openProfile() {
+	if (!ConfMan.hasKey("record_profile"))
+		return;
+
+	Common::Path profilePath(ConfMan.get("record_profile"), Common::Path::kNativeSeparator);
+	_profileFile = new Common::DumpFile();
+	if (!_profileFile->open(profilePath, true)) {
+		warning("playback:action=error reason=\"Can't open profile file\" filename=%s", profilePath.toString(Common::Path::kNativeSeparator).c_str());
+		delete _profileFile;
+		_profileFile = nullptr;
+		return;
+	}
+	_profileFile->writeString("frame,game_time,real_ms\n");
+	_profileFrames = 0;
+	_profileTotalMillis = 0;
+	_profileMaxMillis = 0;
+	_profileLastMillis = g_system->getMillis(true);
+}
+
+void EventRecorder::profileFrame() {
+	if (!_profileFile)
+		return;
+
+	// Real time spent by the engine since the previous screen update. Delays
+	// are skipped in fast playback, so this is the emulation cost of the frame.
+	uint32 millis = g_system->getMillis(true);
+	uint32 frameMillis = millis - _profileLastMillis;
+	_profileLastMillis = millis;
+
+	_profileFrames++;
+	_profileTotalMillis += frameMillis;
+	_profileMaxMillis = MAX(_profileMaxMillis, frameMillis);
+	_profileFile->writeString(Common::String::format("%u,%u,%u\n", _profileFrames, _fakeTimer, frameMillis));
+}
+
+void EventRecorder::closeProfile() {
+	if (!_profileFile)
+		return;
+
+	_profileFile->finalize();
+	delete _profileFile;
+	_profileFile = nullptr;
+
+	debugC(1, kDebugLevelEventRec, "playback:action=profile frames=%u total_ms=%u avg_ms=%.2f max_ms=%u",
+		   _profileFrames, _profileTotalMillis,
+		   _profileFrames ? (double)_profileTotalMillis / _profileFrames : 0.0, _profileMaxMillis);
+}
+
 bool EventRecorder::processAutosave() {
 	return _recordMode == kPassthrough;
 }
@@ -294,6 +349,7 @@ void EventRecorder::processScreenUpdate() {
 		if (_controlPanel)
 			_controlPanel->setReplayedTime(_fakeTimer);
 		_processingMillis = false;
+		profileFrame();
 		break;
 	default:
 		break;
@@ -438,6 +494,7 @@ void EventRecorder::init(const Common::String &recordFileName, RecordMode mode)
 	if ((_recordMode == kRecorderPlayback) || (_recordMode == kRecorderUpdate)) {
 		applyPlaybackSettings();
 		_nextEvent = _playbackFile->getNextEvent();
+		openProfile();
 	}
 	if ((_recordMode == kRecorderRecord) || (_recordMode == kRecorderUpdate)) {
 		getConfig();
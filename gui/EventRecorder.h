@@ -48,6 +48,10 @@
 
 #define g_eventRec (GUI::EventRecorder::instance())
 
+namespace Common {
+	class DumpFile;
+}
+
 namespace GUI {
 	class OnScreenDialog;
 }
@@ -254,6 +258,17 @@ private:
 	void checkRecordedMD5();
 	void deleteTemporarySave();
 	void updateFakeTimer(uint32 millis);
+
+	/** Per-frame playback profile, see --record-profile */
+	void openProfile();
+	void profileFrame();
+	void closeProfile();
+	Common::DumpFile *_profileFile;
+	uint32 _profileFrames;
+	uint32 _profileLastMillis;
+	uint32 _profileTotalMillis;
+	uint32 _profileMaxMillis;
+
 	volatile RecordMode _recordMode;
 	Common::String _recordFileName;
 	bool _fastPlayback;
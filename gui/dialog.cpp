@@ -400,7 +400,8 @@ void Dialog::handleTickle() {
 	if (_focusedWidget && _focusedWidget->getFlags() & WIDGET_WANT_TICKLE)
 		_focusedWidget->handleTickle();
 
-	if (_tickleWidget && _tickleWidget->getFlags() & WIDGET_WANT_TICKLE)
+	// The tickle widget may also be the focused one, which was already tickled
+	if (_tickleWidget && _tickleWidget != _focusedWidget && _tickleWidget->getFlags() & WIDGET_WANT_TICKLE)
 		_tickleWidget->handleTickle();
 }
 
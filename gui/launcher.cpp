@@ -1853,6 +1853,8 @@ void LauncherGrid::build() {
 	_grid = new GridWidget(this, "LauncherGrid.IconArea");
 	_grid->setMultiSelectEnabled(true);
 	_grid->setFilterMatcher(LauncherFilterMatcher, this);
+	// The grid loads thumbnails in the background on tickles
+	setTickleWidget(_grid);
 
 	// Populate the list
 	updateListing();
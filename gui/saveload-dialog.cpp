@@ -326,6 +326,11 @@ void SaveLoadChooserDialog::updateSaveList(bool external) {
 
 void SaveLoadChooserDialog::listSaves() {
 	if (!_metaEngine) return; //very strange
+
+	// Engines list and load the saves with their own code, so any save
+	// still being written out has to be complete first
+	if (g_engine)
+		g_engine->flushPendingSave();
 	_saveList = _metaEngine->listSaves(_target.c_str(), _saveMode);
 
 #ifdef USE_CLOUD
@@ -23,6 +23,7 @@
 #include "common/stream.h"
 #include "common/language.h"
 #include "common/platform.h"
+#include "common/algorithm.h"
 #include "common/tokenizer.h"
 #include "common/translation.h"
 
@@ -482,6 +483,13 @@ Common::SharedPtr<Graphics::ManagedSurface> scaleGfx(Common::SharedPtr<Graphics:
 	return Common::SharedPtr<Graphics::ManagedSurface>(gfx->scale(w, h, filtering));
 }
 
+/// Number of rows above and below the visible area whose thumbnails are loaded ahead
+static const int kThumbnailPrefetchRows = 2;
+/// Time spent decoding thumbnails per tickle, in milliseconds
+static const uint32 kThumbnailLoadBudget = 10;
+/// Memory used by the thumbnails before the least recently visible ones are freed
+static const uint32 kThumbnailCacheSize = 16 * 1024 * 1024;
+
 #pragma mark -
 
 GridWidget::GridWidget(GuiObject *boss, const Common::String &name)
@@ -544,6 +552,8 @@ GridWidget::GridWidget(GuiObject *boss, const Common::String &name)
 	_filterMatcher = GridWidgetDefaultMatcher;
 	_filterMatcherArg = nullptr;
 
+	_thumbnailGeneration = 0;
+
 	setFlags(getFlags() | WIDGET_TRACK_MOUSE | WIDGET_WANT_TICKLE | WIDGET_RETAIN_FOCUS);
 }
 
@@ -551,7 +561,7 @@ GridWidget::~GridWidget() {
 	_platformIcons.clear();
 	_languageIcons.clear();
 	_extraIcons.clear();
-	_loadedSurfaces.clear();
+	clearThumbnails();
 	_disabledIconOverlay.reset();
 	_gridItems.clear();
 	_dataEntryList.clear();
@@ -567,7 +577,10 @@ GridWidget::~GridWidget() {
 Common::SharedPtr<Graphics::ManagedSurface> GridWidget::filenameToSurface(const Common::String &name) {
 	if (name.empty())
 		return nullptr;
-	return _loadedSurfaces[name];
+	Common::HashMap<Common::String, LoadedThumbnail>::const_iterator it = _loadedSurfaces.find(name);
+	if (it == _loadedSurfaces.end())
+		return nullptr;
+	return it->_value.surface;
 }
 
 Common::SharedPtr<Graphics::ManagedSurface> GridWidget::languageToSurface(Common::Language languageCode, Graphics::AlphaType &alphaType) {
@@ -596,6 +609,7 @@ Common::SharedPtr<Graphics::ManagedSurface> GridWidget::disabledThumbnail() {
 }
 
 void GridWidget::setEntryList(Common::Array<GridItemInfo> *list) {
+	_pendingThumbnails.clear();
 	_dataEntryList.clear();
 	_headerEntryList.clear();
 	_sortedEntryList.clear();
@@ -795,36 +809,118 @@ void GridWidget::setGroupHeaderFormat(const Common::U32String &prefix, const Com
 }
 
 void GridWidget::reloadThumbnails() {
+	// Thumbnails are not decoded here, as doing so for a whole page at once
+	// makes opening and scrolling the grid stall. Already loaded ones are
+	// marked as in use, and the others are queued for handleTickle().
+	_thumbnailGeneration++;
+	_pendingThumbnails.clear();
+
+	if (_sortedEntryList.empty())
+		return;
+
+	const int prefetch = kThumbnailPrefetchRows * MAX(_itemsPerRow, 1);
+	const int first = MAX(_firstVisibleItem - prefetch, 0);
+	const int last = MIN(_lastVisibleItem + prefetch, (int)_sortedEntryList.size() - 1);
+
+	// Queue the visible entries first, then the ones around them
+	for (int pass = 0; pass < 2; pass++) {
+		for (int i = first; i <= last; ++i) {
+			bool visible = (i >= _firstVisibleItem && i <= _lastVisibleItem);
+			if (visible != (pass == 0))
+				continue;
+
+			GridItemInfo *entry = _sortedEntryList[i];
+			if (entry->thumbPath.empty())
+				continue;
+
+			Common::HashMap<Common::String, LoadedThumbnail>::iterator it = _loadedSurfaces.find(entry->thumbPath);
+			if (it != _loadedSurfaces.end())
+				it->_value.lastUsed = _thumbnailGeneration;
+			else
+				_pendingThumbnails.push_back(entry);
+		}
+	}
+}
+
+void GridWidget::loadThumbnail(GridItemInfo *entry) {
+	if (_loadedSurfaces.contains(entry->thumbPath))
+		return;
+
 	const int thumbnailWidth = MAX(_thumbnailWidth - 2 * _thumbnailMargin, 0);
 	const int thumbnailHeight = MAX(_thumbnailHeight - 2 * _thumbnailMargin, 0);
-	for (Common::Array<GridItemInfo *>::iterator iter = _visibleEntryList.begin(); iter != _visibleEntryList.end(); ++iter) {
-		GridItemInfo *entry = *iter;
-		if (entry->thumbPath.empty())
-			continue;
-
-		if (!_loadedSurfaces.contains(entry->thumbPath)) {
-			_loadedSurfaces[entry->thumbPath].reset();
-			Common::String path = Common::String::format("icons/%s-%s.png", entry->engineid.c_str(), entry->gameid.c_str());
-			Common::SharedPtr<Graphics::ManagedSurface> surf = loadSurfaceFromFile(path);
-			if (!surf) {
-				path = Common::String::format("icons/%s.png", entry->engineid.c_str());
-				if (!_loadedSurfaces.contains(path)) {
-					surf = loadSurfaceFromFile(path);
-				} else {
-					_loadedSurfaces[entry->thumbPath] = _loadedSurfaces[path];
-				}
-			}
 
-			if (surf) {
-				Common::SharedPtr<Graphics::ManagedSurface> scSurf = scaleGfx(surf, thumbnailWidth, thumbnailHeight, true);
-				_loadedSurfaces[entry->thumbPath] = scSurf;
+	LoadedThumbnail thumb;
+	thumb.lastUsed = _thumbnailGeneration;
 
-				if (path != entry->thumbPath) {
-					_loadedSurfaces[path] = scSurf;
-				}
-			}
+	Common::String path = entry->thumbPath;
+	Common::SharedPtr<Graphics::ManagedSurface> surf = loadSurfaceFromFile(path);
+	if (!surf) {
+		path = Common::String::format("icons/%s.png", entry->engineid.c_str());
+		if (!_loadedSurfaces.contains(path)) {
+			surf = loadSurfaceFromFile(path);
+		} else {
+			LoadedThumbnail &engineThumb = _loadedSurfaces[path];
+			engineThumb.lastUsed = _thumbnailGeneration;
+			thumb.surface = engineThumb.surface;
 		}
 	}
+
+	if (surf) {
+		thumb.surface = scaleGfx(surf, thumbnailWidth, thumbnailHeight, true);
+
+		if (path != entry->thumbPath)
+			_loadedSurfaces[path] = thumb;
+	}
+
+	_loadedSurfaces[entry->thumbPath] = thumb;
+}
+
+bool GridWidget::loadPendingThumbnails() {
+	if (_pendingThumbnails.empty())
+		return false;
+
+	const uint32 start = g_system->getMillis();
+	uint i = 0;
+	do {
+		loadThumbnail(_pendingThumbnails[i++]);
+	} while (i < _pendingThumbnails.size() && g_system->getMillis() - start < kThumbnailLoadBudget);
+
+	_pendingThumbnails.erase(_pendingThumbnails.begin(), _pendingThumbnails.begin() + i);
+
+	pruneThumbnails();
+
+	return true;
+}
+
+static bool thumbnailUsedEarlier(const Common::Pair<uint32, Common::String> &a, const Common::Pair<uint32, Common::String> &b) {
+	return a.first < b.first;
+}
+
+void GridWidget::pruneThumbnails() {
+	// All thumbnails have about the same size, so the memory cap is
+	// turned into a maximum number of loaded thumbnails
+	const uint32 thumbnailSize = MAX(_thumbnailWidth * _thumbnailHeight * g_system->getOverlayFormat().bytesPerPixel, 1);
+	const uint maxThumbnails = MAX<uint>(kThumbnailCacheSize / thumbnailSize, _visibleEntryList.size() * 2);
+	if (_loadedSurfaces.size() <= maxThumbnails)
+		return;
+
+	// Free the thumbnails which have not been visible for the longest time,
+	// never touching the ones in use right now
+	Common::Array<Common::Pair<uint32, Common::String> > candidates;
+	for (Common::HashMap<Common::String, LoadedThumbnail>::const_iterator it = _loadedSurfaces.begin(); it != _loadedSurfaces.end(); ++it) {
+		if (it->_value.lastUsed != _thumbnailGeneration)
+			candidates.push_back(Common::Pair<uint32, Common::String>(it->_value.lastUsed, it->_key));
+	}
+	Common::sort(candidates.begin(), candidates.end(), thumbnailUsedEarlier);
+
+	uint toFree = MIN<uint>(_loadedSurfaces.size() - maxThumbnails, candidates.size());
+	for (uint i = 0; i < toFree; i++)
+		_loadedSurfaces.erase(candidates[i].second);
+}
+
+void GridWidget::clearThumbnails() {
+	_loadedSurfaces.clear();
+	_pendingThumbnails.clear();
 }
 
 void GridWidget::loadFlagIcons() {
@@ -1106,6 +1202,11 @@ void GridWidget::applyScrollPos() {
 void GridWidget::handleTickle() {
 	if (_fluidScroller->update(g_system->getMillis(), _scrollPos))
 		applyScrollPos();
+
+	if (loadPendingThumbnails()) {
+		updateGrid();
+		markAsDirty();
+	}
 }
 
 bool GridWidget::handleKeyDown(Common::KeyState state) {
@@ -1262,7 +1363,7 @@ void GridWidget::reflowLayout() {
 		_extraIcons.clear();
 		_platformIcons.clear();
 		_languageIcons.clear();
-		_loadedSurfaces.clear();
+		clearThumbnails();
 		_platformIconsAlpha.clear();
 		_languageIconsAlpha.clear();
 		_extraIconsAlpha.clear();
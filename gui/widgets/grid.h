@@ -116,8 +116,17 @@ protected:
 	Common::HashMap<int, Graphics::AlphaType> _languageIconsAlpha;
 	Common::HashMap<int, Graphics::AlphaType> _extraIconsAlpha;
 	Common::SharedPtr<Graphics::ManagedSurface> _disabledIconOverlay;
+	struct LoadedThumbnail {
+		Common::SharedPtr<Graphics::ManagedSurface> surface;
+		uint32 lastUsed;	// Value of _thumbnailGeneration when last visible
+
+		LoadedThumbnail() : lastUsed(0) {}
+	};
 	// Images are mapped by filename -> surface.
-	Common::HashMap<Common::String, Common::SharedPtr<Graphics::ManagedSurface> > _loadedSurfaces;
+	Common::HashMap<Common::String, LoadedThumbnail> _loadedSurfaces;
+	// Visible entries, and those close to them, whose thumbnails still need to be decoded
+	Common::Array<GridItemInfo *>		_pendingThumbnails;
+	uint32	_thumbnailGeneration;
 
 	Common::Array<GridItemInfo>			_dataEntryList;
 	Common::Array<GridItemInfo>			_headerEntryList;
@@ -222,6 +231,10 @@ public:
 	void saveClosedGroups(const Common::U32String &groupName);
 
 	void reloadThumbnails();
+	void loadThumbnail(GridItemInfo *entry);
+	bool loadPendingThumbnails();
+	void pruneThumbnails();
+	void clearThumbnails();
 	void loadFlagIcons();
 	void loadPlatformIcons();
 	void loadExtraIcons();
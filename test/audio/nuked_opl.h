@@ -0,0 +1,124 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/scummsys.h"
+
+#ifndef DISABLE_NUKED_OPL
+
+#include "audio/softsynth/opl/nuked.h"
+
+#include <string.h>
+
+// A short register log covering melodic voices, an OPL3 4-op voice and the
+// rhythm section. Each entry is written before generating 'wait' samples.
+struct NukedOPLLogEntry {
+	uint16 reg;
+	uint8 val;
+	uint16 wait;
+};
+
+static const NukedOPLLogEntry nukedOPLLog[] = {
+	{ 0x105, 0x01,   0 }, // OPL3 mode
+	{ 0x001, 0x20,   0 }, // Waveform select
+	{ 0x0bd, 0xc0,   0 }, // Deep tremolo and vibrato
+	// Channel 0
+	{ 0x020, 0x21,   0 }, { 0x023, 0x31,   0 },
+	{ 0x040, 0x18,   0 }, { 0x043, 0x00,   0 },
+	{ 0x060, 0xf2,   0 }, { 0x063, 0xa3,   0 },
+	{ 0x080, 0x54,   0 }, { 0x083, 0x26,   0 },
+	{ 0x0e0, 0x01,   0 }, { 0x0e3, 0x02,   0 },
+	{ 0x0c0, 0x3e,   0 },
+	{ 0x0a0, 0x58,   0 }, { 0x0b0, 0x31, 377 },
+	// Channel 1 on the second register set
+	{ 0x121, 0x02,   0 }, { 0x124, 0x41,   0 },
+	{ 0x141, 0x25,   0 }, { 0x144, 0x05,   0 },
+	{ 0x161, 0xd4,   0 }, { 0x164, 0xf1,   0 },
+	{ 0x181, 0x33,   0 }, { 0x184, 0x17,   0 },
+	{ 0x1c1, 0x1b,   0 },
+	{ 0x1a1, 0x81,   0 }, { 0x1b1, 0x2a, 1031 },
+	// 4-op voice on channels 3/6
+	{ 0x104, 0x01,   0 },
+	{ 0x028, 0x01,   0 }, { 0x02b, 0x01,   0 }, { 0x030, 0x01,   0 }, { 0x033, 0x01,   0 },
+	{ 0x048, 0x1f,   0 }, { 0x04b, 0x12,   0 }, { 0x050, 0x08,   0 }, { 0x053, 0x00,   0 },
+	{ 0x068, 0xf5,   0 }, { 0x06b, 0xf5,   0 }, { 0x070, 0xf5,   0 }, { 0x073, 0xf5,   0 },
+	{ 0x088, 0x0f,   0 }, { 0x08b, 0x0f,   0 }, { 0x090, 0x0f,   0 }, { 0x093, 0x0f,   0 },
+	{ 0x0c3, 0x31,   0 }, { 0x0c6, 0x30,   0 },
+	{ 0x0a3, 0x44,   0 }, { 0x0b3, 0x2d, 2203 },
+	// Pitch bend and key off
+	{ 0x0a0, 0x6b,  97 }, { 0x0a0, 0x81,  97 }, { 0x0b0, 0x11, 513 },
+	// Rhythm section
+	{ 0x0bd, 0xff,   0 },
+	{ 0x030, 0x01,   0 }, { 0x034, 0x01,   0 }, { 0x031, 0x0c,   0 }, { 0x032, 0x04,   0 },
+	{ 0x050, 0x00,   0 }, { 0x054, 0x00,   0 }, { 0x051, 0x00,   0 }, { 0x052, 0x00,   0 },
+	{ 0x070, 0xf8,   0 }, { 0x074, 0xf6,   0 }, { 0x071, 0xf7,   0 }, { 0x072, 0xf7,   0 },
+	{ 0x0c6, 0x30,   0 }, { 0x0c7, 0x30,   0 }, { 0x0c8, 0x30,   0 },
+	{ 0x0a6, 0x57,   0 }, { 0x0b6, 0x09,   0 },
+	{ 0x0a7, 0x41,   0 }, { 0x0b7, 0x09,   0 },
+	{ 0x0a8, 0x57,   0 }, { 0x0b8, 0x05, 4000 },
+	{ 0x0bd, 0xe0, 1500 },
+	{ 0x1b1, 0x0a, 3000 }
+};
+
+class NukedOPLTestSuite : public CxxTest::TestSuite
+{
+public:
+	void test_block_generation_44100() {
+		compareStreams(44100, 512);
+	}
+
+	void test_block_generation_48000() {
+		compareStreams(48000, 1000);
+	}
+
+	void test_block_generation_22050() {
+		compareStreams(22050, 37);
+	}
+
+	void test_block_generation_8000() {
+		compareStreams(8000, 4096);
+	}
+
+private:
+	// Renders the register log through the per-sample reference path and the
+	// block path, and checks both produce exactly the same output.
+	void compareStreams(uint32 rate, uint32 chunk) {
+		OPL::NUKED::opl3_chip *ref = new OPL::NUKED::opl3_chip;
+		OPL::NUKED::opl3_chip *blk = new OPL::NUKED::opl3_chip;
+		OPL::NUKED::OPL3_Reset(ref, rate);
+		OPL::NUKED::OPL3_Reset(blk, rate);
+
+		int16 *refBuf = new int16[chunk * 2];
+		int16 *blkBuf = new int16[chunk * 2];
+		uint32 mismatches = 0;
+		bool audible = false;
+
+		for (uint i = 0; i < ARRAYSIZE(nukedOPLLog); i++) {
+			OPL::NUKED::OPL3_WriteRegBuffered(ref, nukedOPLLog[i].reg, nukedOPLLog[i].val);
+			OPL::NUKED::OPL3_WriteRegBuffered(blk, nukedOPLLog[i].reg, nukedOPLLog[i].val);
+
+			// Stretch the waits so the envelopes reach sustain and release
+			uint32 remaining = nukedOPLLog[i].wait * 8;
+			while (remaining > 0) {
+				uint32 len = MIN(remaining, chunk);
+				OPL::NUKED::OPL3_GenerateStream(ref, refBuf, len);
+				OPL::NUKED::OPL3_GenerateStreamBlock(blk, blkBuf, len);
+				if (memcmp(refBuf, blkBuf, len * 2 * sizeof(int16)) != 0)
+					mismatches++;
+				for (uint32 j = 0; j < len * 2 && !audible; j++)
+					audible = refBuf[j] != 0;
+				remaining -= len;
+			}
+		}
+
+		TS_ASSERT(audible);
+		TS_ASSERT_EQUALS(mismatches, 0u);
+		TS_ASSERT_EQUALS(ref->samplecnt, blk->samplecnt);
+		TS_ASSERT_EQUALS(ref->writebuf_samplecnt, blk->writebuf_samplecnt);
+
+		delete[] refBuf;
+		delete[] blkBuf;
+		delete ref;
+		delete blk;
+	}
+};
+
+#endif
@@ -0,0 +1,85 @@
+#include <cxxtest/TestSuite.h>
+
+#include "audio/softsynth/renderahead.h"
+
+class RenderAheadBufferTestSuite : public CxxTest::TestSuite {
+	// Writes 'frames' frames numbered from 'first', wrapping around if needed
+	static void render(Audio::RenderAheadBuffer &buffer, int16 first, uint32 frames) {
+		while (frames > 0) {
+			uint32 len;
+			int16 *data = buffer.getWriteBuffer(len);
+			len = MIN(len, frames);
+			for (uint32 i = 0; i < len; i++) {
+				data[i * 2] = first;
+				data[i * 2 + 1] = -first;
+				first++;
+			}
+			buffer.commitWrite(len);
+			frames -= len;
+		}
+	}
+
+public:
+	void test_fill_and_read() {
+		Audio::RenderAheadBuffer buffer(100, 1000);
+		TS_ASSERT_EQUALS(buffer.getBufferedFrames(), 0u);
+
+		uint32 len;
+		buffer.getWriteBuffer(len);
+		TS_ASSERT_EQUALS(len, 100u);
+		render(buffer, 0, 100);
+		TS_ASSERT_EQUALS(buffer.getBufferedFrames(), 100u);
+		buffer.getWriteBuffer(len);
+		TS_ASSERT_EQUALS(len, 0u);
+
+		int16 data[60 * 2];
+		TS_ASSERT_EQUALS(buffer.read(data, 60), 60u);
+		TS_ASSERT_EQUALS(data[0], 0);
+		TS_ASSERT_EQUALS(data[59 * 2], 59);
+		TS_ASSERT_EQUALS(data[59 * 2 + 1], -59);
+		TS_ASSERT_EQUALS(buffer.getBufferedFrames(), 40u);
+	}
+
+	void test_wrap_around() {
+		Audio::RenderAheadBuffer buffer(100, 1000);
+		int16 data[100 * 2];
+		render(buffer, 0, 80);
+		TS_ASSERT_EQUALS(buffer.read(data, 70), 70u);
+
+		// The free space is split at the end of the ring
+		uint32 len;
+		buffer.getWriteBuffer(len);
+		TS_ASSERT_EQUALS(len, 21u);
+		render(buffer, 80, 90);
+		TS_ASSERT_EQUALS(buffer.getBufferedFrames(), 100u);
+
+		TS_ASSERT_EQUALS(buffer.read(data, 100), 100u);
+		for (int i = 0; i < 100; i++)
+			TS_ASSERT_EQUALS(data[i * 2], 70 + i);
+	}
+
+	void test_underrun() {
+		Audio::RenderAheadBuffer buffer(100, 1000);
+		int16 data[50 * 2];
+		render(buffer, 0, 20);
+		TS_ASSERT_EQUALS(buffer.read(data, 50), 20u);
+		TS_ASSERT_EQUALS(buffer.getBufferedFrames(), 0u);
+		TS_ASSERT_EQUALS(buffer.read(data, 50), 0u);
+	}
+
+	void test_event_frame() {
+		// 100 frames at 1000 Hz, so one frame per millisecond
+		Audio::RenderAheadBuffer buffer(100, 1000);
+		buffer.advancePlayback(0, 5000);
+		TS_ASSERT_EQUALS(buffer.getEventFrame(5000), 100u);
+
+		// Events keep the same latency between mixer callbacks
+		TS_ASSERT_EQUALS(buffer.getEventFrame(5030), 130u);
+		buffer.advancePlayback(50, 5050);
+		TS_ASSERT_EQUALS(buffer.getEventFrame(5050), 150u);
+		TS_ASSERT_EQUALS(buffer.getEventFrame(5060), 160u);
+
+		// A late mixer does not let events run past the rendered audio
+		TS_ASSERT_EQUALS(buffer.getEventFrame(5500), 250u);
+	}
+};
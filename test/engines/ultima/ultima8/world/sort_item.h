@@ -869,4 +869,54 @@ class U8SortItemTestSuite : public CxxTest::TestSuite {
 		TS_ASSERT(!si1.overlap(si2));
 		TS_ASSERT(!si2.overlap(si1));
 	}
+	/* Moving the screenspace bounds must match recalculating them for the new camera */
+	void test_translate_screen() {
+		Ultima::Ultima8::SortItem si1;
+		Ultima::Ultima8::SortItem si2;
+
+		Ultima::Ultima8::Box b1(18047, 17663, 104, 128, 128, 104);
+		si1.setBoxBounds(b1, 96, 4358);
+		si1.translateScreen(96 - 32, 4358 - 4000);
+		si2.setBoxBounds(b1, 32, 4000);
+
+		TS_ASSERT_EQUALS(si1._sxLeft, si2._sxLeft);
+		TS_ASSERT_EQUALS(si1._sxRight, si2._sxRight);
+		TS_ASSERT_EQUALS(si1._sxTop, si2._sxTop);
+		TS_ASSERT_EQUALS(si1._syTop, si2._syTop);
+		TS_ASSERT_EQUALS(si1._sxBot, si2._sxBot);
+		TS_ASSERT_EQUALS(si1._syBot, si2._syBot);
+		TS_ASSERT(si1._sr == si2._sr);
+	}
+
+	/* Removing a dependency keeps the order of the others */
+	void test_depends_remove() {
+		Ultima::Ultima8::SortItem si1;
+		Ultima::Ultima8::SortItem si2;
+		Ultima::Ultima8::SortItem si3;
+		Ultima::Ultima8::SortItem si4;
+
+		si2.setBoxBounds(Ultima::Ultima8::Box(0, 0, 0, 32, 32, 8), 0, 0);
+		si3.setBoxBounds(Ultima::Ultima8::Box(0, 0, 8, 32, 32, 8), 0, 0);
+		si4.setBoxBounds(Ultima::Ultima8::Box(0, 0, 16, 32, 32, 8), 0, 0);
+
+		si1._depends.insert_sorted(&si4);
+		si1._depends.insert_sorted(&si2);
+		si1._depends.insert_sorted(&si3);
+
+		si1._depends.remove(&si3);
+		Ultima::Ultima8::SortItem::DependsList::iterator it = si1._depends.begin();
+		TS_ASSERT_EQUALS(*it, &si2);
+		++it;
+		TS_ASSERT_EQUALS(*it, &si4);
+		++it;
+		TS_ASSERT(!(it != si1._depends.end()));
+
+		si1._depends.remove(&si4);
+		si1._depends.remove(&si2);
+		TS_ASSERT(!(si1._depends.begin() != si1._depends.end()));
+
+		// Removed nodes are reused
+		si1._depends.push_back(&si3);
+		TS_ASSERT_EQUALS(*si1._depends.begin(), &si3);
+	}
 };